@@ -0,0 +1,2 @@
+SET inflector_acronyms = ['HTML', 'API', 'URL', 'ID'];
+CREATE TABLE corpus AS SELECT concat('user', ['Account', 'Order', 'Item', 'Event', 'Session'][i % 5 + 1], 'Id', i % 997) AS v FROM range(1000000) t(i);
@@ -0,0 +1,2 @@
+SET inflector_acronyms = ['HTML', 'API', 'URL', 'ID'];
+CREATE TABLE corpus AS SELECT concat('customerLifetimeValue', ['Aggregated', 'Projected', 'Discounted'][i % 3 + 1], 'ByRegionAndSalesChannel', i % 997, 'WithHTMLPreviewAndAPIKey') AS v FROM range(1000000) t(i);
@@ -0,0 +1,2 @@
+SET inflector_acronyms = ['HTML', 'API', 'URL', 'ID'];
+CREATE TABLE corpus AS SELECT concat('user_', ['account', 'order', 'item', 'event', 'session'][i % 5 + 1], '_id_', i % 997) AS v FROM range(1000000) t(i);
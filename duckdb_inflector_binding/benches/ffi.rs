@@ -0,0 +1,135 @@
+//! Microbenchmarks of the C entry points, to tell the cost of crossing the
+//! FFI boundary apart from the cost of the conversion itself.
+//!
+//! Each corpus is converted three ways:
+//! - `direct`: `convert_case` called from Rust, the conversion cost alone
+//! - `batch`: `cruet_transform_batch` once per 2048 row chunk, as DuckDB does
+//! - `single`: `cruet_transform_batch` once per value, the cost of one call per row
+//!
+//! Run with `cargo bench --bench ffi`.
+
+use std::hint::black_box;
+use std::os::raw::c_char;
+use std::ptr;
+use std::time::{Duration, Instant};
+
+use convert_case::{Case, Casing};
+use duckdb_inflector_binding::*;
+
+const ROWS: usize = 200_000;
+const CHUNK: usize = 2048;
+const ITERATIONS: usize = 5;
+
+fn corpus(name: &str) -> Vec<String> {
+    (0..ROWS)
+        .map(|i| match name {
+            "ascii" => format!("user{}Id{}", ["Account", "Order", "Item"][i % 3], i % 997),
+            "ascii_long" => format!(
+                "customerLifetimeValue{}ByRegionAndSalesChannel{}WithPreview",
+                ["Aggregated", "Projected", "Discounted"][i % 3],
+                i % 997
+            ),
+            "unicode" => format!(
+                "libellé{}Été{}",
+                ["Civilité", "Données", "Entrée"][i % 3],
+                i % 997
+            ),
+            _ => unreachable!(),
+        })
+        .collect()
+}
+
+/// Runs `f` a few times and returns the fastest run
+fn measure<F: FnMut() -> usize>(mut f: F) -> Duration {
+    let mut best = Duration::MAX;
+    for _ in 0..ITERATIONS {
+        let start = Instant::now();
+        black_box(f());
+        best = best.min(start.elapsed());
+    }
+    best
+}
+
+fn report(corpus: &str, method: &str, elapsed: Duration, bytes: usize) {
+    let ns_per_row = elapsed.as_nanos() as f64 / ROWS as f64;
+    let mb_per_s = bytes as f64 / elapsed.as_secs_f64() / 1e6;
+    println!("{corpus:<12} {method:<10} {ns_per_row:>8.1} ns/row {mb_per_s:>8.1} MB/s");
+}
+
+fn direct(values: &[String]) -> usize {
+    values.iter().map(|v| v.to_case(Case::Snake).len()).sum()
+}
+
+fn batch(
+    values: &[String],
+    chunk_size: usize,
+    arena_data: &mut Vec<u8>,
+    offsets: &mut Vec<usize>,
+) -> usize {
+    let table = InflectorAcronymTable {
+        words: ptr::null(),
+        count: 0,
+        plural_rules: ptr::null(),
+    };
+    let mut total = 0;
+    for chunk in values.chunks(chunk_size) {
+        let inputs: Vec<InflectorString> = chunk
+            .iter()
+            .map(|v| InflectorString {
+                data: v.as_ptr() as *const c_char,
+                len: v.len(),
+            })
+            .collect();
+        let mut start = 0;
+        loop {
+            let mut arena = InflectorArena {
+                data: arena_data.as_mut_ptr() as *mut c_char,
+                capacity: arena_data.len(),
+                offsets: offsets.as_mut_ptr(),
+                required: 0,
+            };
+            let done = cruet_transform_batch(
+                InflectorTransform::SnakeCase,
+                &table,
+                inputs.as_ptr(),
+                ptr::null(),
+                start,
+                chunk.len(),
+                &mut arena,
+                ptr::null_mut(),
+            );
+            total += offsets[done] - offsets[start];
+            if done == chunk.len() {
+                break;
+            }
+            // Earlier results of the chunk are not needed, so the arena is reused from the start
+            let grown = (arena_data.len() * 2).max(arena_data.len() + arena.required);
+            arena_data.resize(grown, 0);
+            start = done;
+        }
+    }
+    total
+}
+
+fn main() {
+    for name in ["ascii", "ascii_long", "unicode"] {
+        let values = corpus(name);
+        let bytes: usize = values.iter().map(|v| v.len()).sum();
+        let mut arena_data = vec![0u8; 64 * 1024];
+        let mut offsets = vec![0usize; CHUNK + 1];
+
+        report(name, "direct", measure(|| direct(&values)), bytes);
+        report(
+            name,
+            "batch",
+            measure(|| batch(&values, CHUNK, &mut arena_data, &mut offsets)),
+            bytes,
+        );
+        report(
+            name,
+            "single",
+            measure(|| batch(&values, 1, &mut arena_data, &mut offsets)),
+            bytes,
+        );
+    }
+}
@@ -1,74 +1,230 @@
-use std::collections::HashSet;
-use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_uchar};
+use std::collections::{HashMap, HashSet};
+use std::os::raw::c_char;
 use std::ptr;
-use std::sync::{OnceLock, RwLock};
+use std::slice;
 
 use convert_case::{Case, Casing};
 
-// --- Global acronym storage ---
+// --- Acronym-aware case conversion ---
 
-fn acronyms() -> &'static RwLock<HashSet<String>> {
-    static ACRONYMS: OnceLock<RwLock<HashSet<String>>> = OnceLock::new();
-    ACRONYMS.get_or_init(|| RwLock::new(HashSet::new()))
+fn capitalize(s: &str) -> String {
+    let mut chars = s.chars();
+    match chars.next() {
+        None => String::new(),
+        Some(c) => {
+            let mut result = c.to_uppercase().to_string();
+            result.push_str(chars.as_str());
+            result
+        }
+    }
 }
 
-/// Set acronyms from a comma-separated string. Tokens are uppercased.
-/// Single-character tokens are silently ignored (minimum 2 chars).
-#[no_mangle]
-pub extern "C" fn cruet_set_acronyms(csv: *const c_char) {
-    if csv.is_null() {
-        return;
+/// A set of acronyms, stored uppercased.
+trait Acronyms {
+    fn is_empty(&self) -> bool;
+    /// Whether `word`, uppercased, is one of the acronyms.
+    fn contains_word(&self, word: &str) -> bool;
+}
+
+/// Acronyms resolved by the caller when a query is bound: uppercased, at
+/// least two characters long and sorted bytewise. The table is immutable
+/// for the duration of a call, so lookups take no locks.
+///
+/// The plural rules compiled for the same query travel along with it; null
+/// means cruet's rules only.
+#[repr(C)]
+pub struct InflectorAcronymTable {
+    pub words: *const InflectorString,
+    pub count: usize,
+    pub plural_rules: *const InflectorPluralRules,
+}
+
+/// Borrowed view of an `InflectorAcronymTable`.
+struct AcronymTable<'a> {
+    words: &'a [InflectorString],
+    plural_rules: Option<&'a InflectorPluralRules>,
+}
+
+impl<'a> AcronymTable<'a> {
+    fn from_ptr(table: *const InflectorAcronymTable) -> AcronymTable<'a> {
+        if table.is_null() {
+            return AcronymTable {
+                words: &[],
+                plural_rules: None,
+            };
+        }
+        let table = unsafe { &*table };
+        let plural_rules = unsafe { table.plural_rules.as_ref() };
+        if table.words.is_null() || table.count == 0 {
+            return AcronymTable {
+                words: &[],
+                plural_rules,
+            };
+        }
+        AcronymTable {
+            words: unsafe { slice::from_raw_parts(table.words, table.count) },
+            plural_rules,
+        }
     }
-    let s = unsafe { CStr::from_ptr(csv).to_str().unwrap() };
-    let mut set = HashSet::new();
-    for token in s.split(',') {
-        let trimmed = token.trim().to_uppercase();
-        if trimmed.len() >= 2 {
-            set.insert(trimmed);
+}
+
+impl Acronyms for AcronymTable<'_> {
+    fn is_empty(&self) -> bool {
+        self.words.is_empty()
+    }
+
+    fn contains_word(&self, word: &str) -> bool {
+        // Code point order matches the bytewise order of UTF-8, so the word
+        // can be uppercased lazily while comparing
+        self.words
+            .binary_search_by(|acronym| {
+                input_str(acronym)
+                    .chars()
+                    .cmp(word.chars().flat_map(char::to_uppercase))
+            })
+            .is_ok()
+    }
+}
+
+// --- User-defined plural rules ---
+
+/// Irregular plurals and uncountable words added on top of cruet's rules,
+/// keyed by their lowercase form. Compiled once per query by
+/// `cruet_compile_plural_rules` and only read afterwards, so threads share
+/// it without locking.
+pub struct InflectorPluralRules {
+    /// Singular -> plural
+    plurals: HashMap<String, String>,
+    /// Plural -> singular
+    singulars: HashMap<String, String>,
+    uncountables: HashSet<String>,
+}
+
+impl InflectorPluralRules {
+    /// Applies the rules to the last word of `s`, mapping it through `forms`.
+    /// A word that is already in the target form (a key of `inverse`) or is
+    /// uncountable is kept. Returns None if no rule covers the word.
+    fn apply(
+        &self,
+        s: &str,
+        forms: &HashMap<String, String>,
+        inverse: &HashMap<String, String>,
+    ) -> Option<String> {
+        let (prefix, word) = split_last_word(s);
+        if word.is_empty() {
+            return None;
+        }
+        let lower = word.to_lowercase();
+        if let Some(form) = forms.get(&lower) {
+            return Some(format!("{}{}", prefix, match_case(form, word)));
         }
+        if self.uncountables.contains(&lower) || inverse.contains_key(&lower) {
+            return Some(s.to_string());
+        }
+        None
     }
-    *acronyms().write().unwrap() = set;
 }
 
-/// Get the current acronyms as a sorted comma-separated string.
-/// Caller must free the returned string with `free_c_string`.
-#[no_mangle]
-pub extern "C" fn cruet_get_acronyms() -> *mut c_char {
-    let set = acronyms().read().unwrap();
-    let mut sorted: Vec<&String> = set.iter().collect();
-    sorted.sort();
-    let csv = sorted
-        .into_iter()
-        .map(|s| s.as_str())
-        .collect::<Vec<_>>()
-        .join(",");
-    CString::new(csv).unwrap().into_raw()
-}
-
-/// Clear all configured acronyms, restoring default behavior.
-#[no_mangle]
-pub extern "C" fn cruet_clear_acronyms() {
-    acronyms().write().unwrap().clear();
+/// Splits `s` before its last word: the trailing run of alphanumeric
+/// characters, cut where a lowercase letter or digit is followed by an
+/// uppercase one (`userDatum` -> `user`, `Datum`).
+fn split_last_word(s: &str) -> (&str, &str) {
+    let mut start = s.len();
+    let mut next: Option<char> = None;
+    for (i, c) in s.char_indices().rev() {
+        if !c.is_alphanumeric() {
+            break;
+        }
+        if let Some(next) = next {
+            if next.is_uppercase() && (c.is_lowercase() || c.is_numeric()) {
+                break;
+            }
+        }
+        start = i;
+        next = Some(c);
+    }
+    s.split_at(start)
 }
 
-// --- Acronym-aware case conversion ---
+/// Renders the lowercase `form` in the case of `word`: all uppercase,
+/// capitalized or as it is.
+fn match_case(form: &str, word: &str) -> String {
+    let mut letters = word.chars().filter(|c| c.is_alphabetic());
+    match letters.next() {
+        Some(first) if first.is_uppercase() => {
+            if word.chars().count() > 1 && letters.all(char::is_uppercase) {
+                form.to_uppercase()
+            } else {
+                capitalize(form)
+            }
+        }
+        _ => form.to_string(),
+    }
+}
 
-fn capitalize(s: &str) -> String {
-    let mut chars = s.chars();
-    match chars.next() {
-        None => String::new(),
-        Some(c) => {
-            let mut result = c.to_uppercase().to_string();
-            result.push_str(chars.as_str());
-            result
+fn to_plural_with(s: &str, rules: Option<&InflectorPluralRules>) -> String {
+    rules
+        .and_then(|rules| rules.apply(s, &rules.plurals, &rules.singulars))
+        .unwrap_or_else(|| cruet::to_plural(s))
+}
+
+fn to_singular_with(s: &str, rules: Option<&InflectorPluralRules>) -> String {
+    rules
+        .and_then(|rules| rules.apply(s, &rules.singulars, &rules.plurals))
+        .unwrap_or_else(|| cruet::to_singular(s))
+}
+
+/// Compile `irregular_count` (singular, plural) pairs, stored back to back in
+/// `irregulars`, and `uncountable_count` uncountable words into rules for
+/// `InflectorAcronymTable::plural_rules`. Release them with
+/// `cruet_free_plural_rules`.
+#[no_mangle]
+pub extern "C" fn cruet_compile_plural_rules(
+    irregulars: *const InflectorString,
+    irregular_count: usize,
+    uncountables: *const InflectorString,
+    uncountable_count: usize,
+) -> *mut InflectorPluralRules {
+    let mut rules = InflectorPluralRules {
+        plurals: HashMap::with_capacity(irregular_count),
+        singulars: HashMap::with_capacity(irregular_count),
+        uncountables: HashSet::with_capacity(uncountable_count),
+    };
+    if !irregulars.is_null() {
+        let irregulars = unsafe { slice::from_raw_parts(irregulars, irregular_count * 2) };
+        for pair in irregulars.chunks_exact(2) {
+            let singular = input_str(&pair[0]).trim().to_lowercase();
+            let plural = input_str(&pair[1]).trim().to_lowercase();
+            if singular.is_empty() || plural.is_empty() {
+                continue;
+            }
+            rules.plurals.insert(singular.clone(), plural.clone());
+            rules.singulars.insert(plural, singular);
+        }
+    }
+    if !uncountables.is_null() {
+        let uncountables = unsafe { slice::from_raw_parts(uncountables, uncountable_count) };
+        for word in uncountables {
+            let word = input_str(word).trim().to_lowercase();
+            if !word.is_empty() {
+                rules.uncountables.insert(word);
+            }
         }
     }
+    Box::into_raw(Box::new(rules))
 }
 
-fn convert_with_acronyms(input: &str, case: Case) -> String {
-    let acros = acronyms().read().unwrap();
+/// Free rules returned by `cruet_compile_plural_rules`
+#[no_mangle]
+pub extern "C" fn cruet_free_plural_rules(rules: *mut InflectorPluralRules) {
+    if !rules.is_null() {
+        unsafe {
+            drop(Box::from_raw(rules));
+        }
+    }
+}
 
+fn convert_with<A: Acronyms>(input: &str, case: Case, acros: &A) -> String {
     if acros.is_empty() {
         return input.to_case(case);
     }
@@ -83,9 +239,8 @@ fn convert_with_acronyms(input: &str, case: Case) -> String {
             snake
                 .split('_')
                 .map(|w| {
-                    let upper = w.to_uppercase();
-                    if acros.contains(&upper) {
-                        upper
+                    if acros.contains_word(w) {
+                        w.to_uppercase()
                     } else {
                         capitalize(w)
                     }
@@ -103,9 +258,8 @@ fn convert_with_acronyms(input: &str, case: Case) -> String {
                     if i == 0 {
                         w.to_lowercase()
                     } else {
-                        let upper = w.to_uppercase();
-                        if acros.contains(&upper) {
-                            upper
+                        if acros.contains_word(w) {
+                            w.to_uppercase()
                         } else {
                             capitalize(w)
                         }
@@ -120,9 +274,8 @@ fn convert_with_acronyms(input: &str, case: Case) -> String {
             snake
                 .split('_')
                 .map(|w| {
-                    let upper = w.to_uppercase();
-                    if acros.contains(&upper) {
-                        upper
+                    if acros.contains_word(w) {
+                        w.to_uppercase()
                     } else {
                         capitalize(w)
                     }
@@ -136,9 +289,8 @@ fn convert_with_acronyms(input: &str, case: Case) -> String {
             snake
                 .split('_')
                 .map(|w| {
-                    let upper = w.to_uppercase();
-                    if acros.contains(&upper) {
-                        upper
+                    if acros.contains_word(w) {
+                        w.to_uppercase()
                     } else {
                         capitalize(w)
                     }
@@ -153,9 +305,8 @@ fn convert_with_acronyms(input: &str, case: Case) -> String {
                 .split('_')
                 .enumerate()
                 .map(|(i, w)| {
-                    let upper = w.to_uppercase();
-                    if acros.contains(&upper) {
-                        upper
+                    if acros.contains_word(w) {
+                        w.to_uppercase()
                     } else if i == 0 {
                         capitalize(w)
                     } else {
@@ -171,187 +322,533 @@ fn convert_with_acronyms(input: &str, case: Case) -> String {
     }
 }
 
-/// --- Transform single string ---
-/// Returns a newly allocated C string (caller must free)
-fn transform_single<F>(input: *const c_char, f: F) -> *mut c_char
-where
-    F: Fn(&str) -> String,
-{
-    if input.is_null() {
-        return ptr::null_mut();
-    }
+/// --- Batched, length-delimited FFI ---
 
-    let s = unsafe { CStr::from_ptr(input).to_str().unwrap() };
-    CString::new(f(s)).unwrap().into_raw()
+/// A borrowed string passed by pointer and length. It does not need to be
+/// NUL terminated.
+#[repr(C)]
+pub struct InflectorString {
+    pub data: *const c_char,
+    pub len: usize,
 }
 
-/// --- Predicate single string ---
-/// Returns 1 if true, 0 if false or NULL
-fn predicate_single<F>(input: *const c_char, f: F) -> c_uchar
-where
-    F: Fn(&str) -> bool,
-{
-    if input.is_null() {
-        return 0;
-    }
-
-    let s = unsafe { CStr::from_ptr(input).to_str().unwrap() };
-    if f(s) { 1 } else { 0 }
+/// Caller-owned output arena for `cruet_transform_batch`.
+///
+/// Results are written back to back into `data` without NUL terminators.
+/// `offsets` must hold `count + 1` entries; row `i` occupies
+/// `data[offsets[i]..offsets[i + 1]]` (an empty range for NULL rows).
+#[repr(C)]
+pub struct InflectorArena {
+    pub data: *mut c_char,
+    pub capacity: usize,
+    pub offsets: *mut usize,
+    /// Set to the size of the first result that did not fit, 0 otherwise.
+    pub required: usize,
 }
 
-/// Free a single C string returned by the transform functions
-#[no_mangle]
-pub extern "C" fn free_c_string(s: *mut c_char) {
-    if !s.is_null() {
-        unsafe {
-            drop(CString::from_raw(s));
-        }
-    }
+/// Transforms that can be applied with `cruet_transform_batch`.
+#[repr(C)]
+#[derive(Clone, Copy, PartialEq, Eq, Debug)]
+pub enum InflectorTransform {
+    ClassCase,
+    CamelCase,
+    PascalCase,
+    ScreamingSnakeCase,
+    SnakeCase,
+    KebabCase,
+    TrainCase,
+    SentenceCase,
+    TitleCase,
+    UpperCase,
+    LowerCase,
+    TableCase,
+    Ordinalize,
+    Deordinalize,
+    ForeignKey,
+    Demodulize,
+    Deconstantize,
+    Plural,
+    Singular,
 }
 
-fn to_lower_case(s: &str) -> String {
-    s.to_lowercase()
+/// Predicates that can be applied with `cruet_predicate_batch`.
+#[repr(C)]
+#[derive(Clone, Copy, PartialEq, Eq, Debug)]
+pub enum InflectorPredicate {
+    ClassCase,
+    CamelCase,
+    PascalCase,
+    ScreamingSnakeCase,
+    SnakeCase,
+    KebabCase,
+    TrainCase,
+    SentenceCase,
+    TitleCase,
+    TableCase,
+    ForeignKey,
 }
 
-fn to_upper_case(s: &str) -> String {
-    s.to_uppercase()
+/// Flags returned by `cruet_detect_case_batch`, one per case style.
+#[repr(C)]
+#[derive(Clone, Copy, PartialEq, Eq, Debug)]
+pub enum InflectorCase {
+    Snake = 1,
+    Kebab = 2,
+    Camel = 4,
+    Pascal = 8,
+    ScreamingSnake = 16,
+    Train = 32,
+    Title = 64,
+    Sentence = 128,
+    Table = 256,
+    ForeignKey = 512,
 }
 
-fn to_table_case(s: &str) -> String {
-    let snake = s.to_case(Case::Snake);
-    cruet::to_plural(&snake)
+fn apply_transform(transform: InflectorTransform, s: &str, acros: &AcronymTable) -> String {
+    use InflectorTransform::*;
+    match transform {
+        ClassCase | PascalCase => convert_with(s, Case::Pascal, acros),
+        CamelCase => convert_with(s, Case::Camel, acros),
+        ScreamingSnakeCase => convert_with(s, Case::UpperSnake, acros),
+        SnakeCase => convert_with(s, Case::Snake, acros),
+        KebabCase => convert_with(s, Case::Kebab, acros),
+        TrainCase => convert_with(s, Case::Train, acros),
+        SentenceCase => convert_with(s, Case::Sentence, acros),
+        TitleCase => convert_with(s, Case::Title, acros),
+        UpperCase => to_upper_case(s),
+        LowerCase => to_lower_case(s),
+        TableCase => to_table_case(s, acros.plural_rules),
+        Ordinalize => cruet::ordinalize(s),
+        Deordinalize => cruet::deordinalize(s),
+        ForeignKey => to_foreign_key(s),
+        Demodulize => cruet::demodulize(s),
+        Deconstantize => cruet::deconstantize(s),
+        Plural => to_plural_with(s, acros.plural_rules),
+        Singular => to_singular_with(s, acros.plural_rules),
+    }
 }
 
-fn to_foreign_key(s: &str) -> String {
-    let snake = s.to_case(Case::Snake);
-    if snake.ends_with("_id") {
-        snake
-    } else {
-        format!("{}_id", snake)
+fn apply_predicate(predicate: InflectorPredicate, s: &str, acros: &AcronymTable) -> bool {
+    use InflectorPredicate::*;
+    match predicate {
+        ClassCase | PascalCase => convert_with(s, Case::Pascal, acros) == s,
+        CamelCase => convert_with(s, Case::Camel, acros) == s,
+        ScreamingSnakeCase => convert_with(s, Case::UpperSnake, acros) == s,
+        SnakeCase => convert_with(s, Case::Snake, acros) == s,
+        KebabCase => convert_with(s, Case::Kebab, acros) == s,
+        TrainCase => convert_with(s, Case::Train, acros) == s,
+        SentenceCase => convert_with(s, Case::Sentence, acros) == s,
+        TitleCase => convert_with(s, Case::Title, acros) == s,
+        TableCase => to_table_case(s, acros.plural_rules) == s,
+        ForeignKey => to_foreign_key(s) == s,
     }
 }
 
-// --- Transform wrappers ---
-#[no_mangle]
-pub extern "C" fn cruet_to_class_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Pascal))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_camel_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Camel))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_pascal_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Pascal))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_screamingsnake_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::UpperSnake))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_snake_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Snake))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_kebab_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Kebab))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_train_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Train))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_sentence_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Sentence))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_title_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, |s| convert_with_acronyms(s, Case::Title))
-}
-#[no_mangle]
-pub extern "C" fn cruet_to_lower_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, to_lower_case)
+/// Returns true if `row` is valid in a DuckDB-style validity mask
+/// (one bit per row, least significant bit first). A null mask means
+/// every row is valid.
+fn row_is_valid(validity: *const u64, row: usize) -> bool {
+    if validity.is_null() {
+        return true;
+    }
+    let entry = unsafe { *validity.add(row / 64) };
+    (entry >> (row % 64)) & 1 == 1
 }
-#[no_mangle]
-pub extern "C" fn cruet_to_upper_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, to_upper_case)
+
+fn set_row(mask: *mut u64, row: usize) {
+    unsafe { *mask.add(row / 64) |= 1 << (row % 64) };
 }
 
-#[no_mangle]
-pub extern "C" fn cruet_to_table_case(s: *const c_char) -> *mut c_char {
-    transform_single(s, to_table_case)
+/// Borrows the bytes of an `InflectorString` as `&str`. DuckDB strings are
+/// always valid UTF-8, but invalid input is replaced rather than trusted.
+fn input_str<'a>(input: &'a InflectorString) -> std::borrow::Cow<'a, str> {
+    if input.len == 0 || input.data.is_null() {
+        return std::borrow::Cow::Borrowed("");
+    }
+    let bytes = unsafe { slice::from_raw_parts(input.data as *const u8, input.len) };
+    String::from_utf8_lossy(bytes)
 }
-#[no_mangle]
-pub extern "C" fn cruet_ordinalize(s: *const c_char) -> *mut c_char {
-    transform_single(s, cruet::ordinalize)
+
+/// Apply `transform` to rows `start..count` of `inputs`, writing the results
+/// into `arena`. Rows that are not set in `validity` are skipped. A null
+/// `acronyms` table means no acronyms.
+///
+/// If `unchanged` is not null it must be a zeroed bit mask like `validity`.
+/// Rows whose result equals their input are then flagged in it instead of
+/// being copied, and occupy an empty range of the arena.
+///
+/// Returns the number of rows completed (always counted from row 0). When it
+/// is less than `count` the next result did not fit in the arena: its size is
+/// stored in `arena.required` and the caller should resume from the returned
+/// row with a larger arena.
+#[no_mangle]
+pub extern "C" fn cruet_transform_batch(
+    transform: InflectorTransform,
+    acronyms: *const InflectorAcronymTable,
+    inputs: *const InflectorString,
+    validity: *const u64,
+    start: usize,
+    count: usize,
+    arena: *mut InflectorArena,
+    unchanged: *mut u64,
+) -> usize {
+    if inputs.is_null() || arena.is_null() || start >= count {
+        return count;
+    }
+    let inputs = unsafe { slice::from_raw_parts(inputs, count) };
+    let arena = unsafe { &mut *arena };
+    let offsets = unsafe { slice::from_raw_parts_mut(arena.offsets, count + 1) };
+    let acronyms = AcronymTable::from_ptr(acronyms);
+
+    let mut written = 0usize;
+    offsets[start] = 0;
+    arena.required = 0;
+    for row in start..count {
+        if row_is_valid(validity, row) {
+            let input = input_str(&inputs[row]);
+            let result = apply_transform(transform, &input, &acronyms);
+            if !unchanged.is_null() && result == *input {
+                set_row(unchanged, row);
+                offsets[row + 1] = written;
+                continue;
+            }
+            let bytes = result.as_bytes();
+            if written + bytes.len() > arena.capacity {
+                arena.required = bytes.len();
+                return row;
+            }
+            unsafe {
+                ptr::copy_nonoverlapping(
+                    bytes.as_ptr(),
+                    (arena.data as *mut u8).add(written),
+                    bytes.len(),
+                );
+            }
+            written += bytes.len();
+        }
+        offsets[row + 1] = written;
+    }
+    count
 }
-#[no_mangle]
-pub extern "C" fn cruet_deordinalize(s: *const c_char) -> *mut c_char {
-    transform_single(s, cruet::deordinalize)
+
+/// Apply `predicate` to `count` rows of `inputs`, writing one bool per row to
+/// `out`. Rows that are not set in `validity` are left untouched, so the
+/// caller can fill them in itself. A null `acronyms` table means no acronyms.
+#[no_mangle]
+pub extern "C" fn cruet_predicate_batch(
+    predicate: InflectorPredicate,
+    acronyms: *const InflectorAcronymTable,
+    inputs: *const InflectorString,
+    validity: *const u64,
+    count: usize,
+    out: *mut bool,
+) {
+    if inputs.is_null() || out.is_null() {
+        return;
+    }
+    let inputs = unsafe { slice::from_raw_parts(inputs, count) };
+    let out = unsafe { slice::from_raw_parts_mut(out, count) };
+    let acronyms = AcronymTable::from_ptr(acronyms);
+    for row in 0..count {
+        if row_is_valid(validity, row) {
+            out[row] = apply_predicate(predicate, &input_str(&inputs[row]), &acronyms);
+        }
+    }
 }
-#[no_mangle]
-pub extern "C" fn cruet_to_foreign_key(s: *const c_char) -> *mut c_char {
-    transform_single(s, to_foreign_key)
+
+#[derive(Clone, Copy)]
+enum WordCase {
+    Lower,
+    Upper,
+    Capital,
 }
-#[no_mangle]
-pub extern "C" fn cruet_demodulize(s: *const c_char) -> *mut c_char {
-    transform_single(s, cruet::demodulize)
+
+/// How `convert_with` renders the words of a case style.
+struct CaseStyle {
+    flag: InflectorCase,
+    first: WordCase,
+    rest: WordCase,
+    first_acronyms: bool,
+    rest_acronyms: bool,
+    delimiter: &'static str,
 }
-#[no_mangle]
-pub extern "C" fn cruet_deconstantize(s: *const c_char) -> *mut c_char {
-    transform_single(s, cruet::deconstantize)
+
+impl CaseStyle {
+    const fn new(
+        flag: InflectorCase,
+        first: WordCase,
+        rest: WordCase,
+        acronyms: (bool, bool),
+        delimiter: &'static str,
+    ) -> CaseStyle {
+        CaseStyle {
+            flag,
+            first,
+            rest,
+            first_acronyms: acronyms.0,
+            rest_acronyms: acronyms.1,
+            delimiter,
+        }
+    }
 }
-#[no_mangle]
-pub extern "C" fn cruet_to_plural(s: *const c_char) -> *mut c_char {
-    transform_single(s, cruet::to_plural)
+
+/// The case styles of `convert_with`, as rendered by `render_words`.
+const CASE_STYLES: [CaseStyle; 8] = {
+    use InflectorCase::*;
+    use WordCase::*;
+    [
+        CaseStyle::new(Snake, Lower, Lower, (false, false), "_"),
+        CaseStyle::new(Kebab, Lower, Lower, (false, false), "-"),
+        CaseStyle::new(Camel, Lower, Capital, (false, true), ""),
+        CaseStyle::new(Pascal, Capital, Capital, (true, true), ""),
+        CaseStyle::new(ScreamingSnake, Upper, Upper, (false, false), "_"),
+        CaseStyle::new(Train, Capital, Capital, (true, true), "-"),
+        CaseStyle::new(Title, Capital, Capital, (true, true), " "),
+        CaseStyle::new(Sentence, Capital, Lower, (true, true), " "),
+    ]
+};
+
+/// Renders the (lowercase) words of a snake case string in `style` into `out`.
+fn render_words(words: &[&str], style: &CaseStyle, acros: &AcronymTable, out: &mut String) {
+    out.clear();
+    for (i, word) in words.iter().enumerate() {
+        if i > 0 {
+            out.push_str(style.delimiter);
+        }
+        let (word_case, check_acronyms) = if i == 0 {
+            (style.first, style.first_acronyms)
+        } else {
+            (style.rest, style.rest_acronyms)
+        };
+        let word_case = if check_acronyms && acros.contains_word(word) {
+            WordCase::Upper
+        } else {
+            word_case
+        };
+        match word_case {
+            WordCase::Lower => out.push_str(word),
+            WordCase::Upper => out.extend(word.chars().flat_map(char::to_uppercase)),
+            WordCase::Capital => {
+                let mut chars = word.chars();
+                if let Some(c) = chars.next() {
+                    out.extend(c.to_uppercase());
+                    out.push_str(chars.as_str());
+                }
+            }
+        }
+    }
 }
-#[no_mangle]
-pub extern "C" fn cruet_to_singular(s: *const c_char) -> *mut c_char {
-    transform_single(s, cruet::to_singular)
+
+/// Characters like 'İ' do not round-trip through the lowercase words of the
+/// snake case form, so strings containing them are converted once per style.
+fn round_trips_case(s: &str) -> bool {
+    s.chars()
+        .all(|c| c.to_lowercase().count() == 1 && c.to_uppercase().count() == 1)
 }
 
-// --- Predicate wrappers ---
-#[no_mangle]
-pub extern "C" fn cruet_is_class_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Pascal) == s)
+fn snake_words(snake: &str) -> Vec<&str> {
+    snake.split('_').filter(|w| !w.is_empty()).collect()
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_camel_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Camel) == s)
+
+/// The style `convert_with` renders a transform in, if it is a case style.
+fn transform_style(transform: InflectorTransform) -> Option<&'static CaseStyle> {
+    use InflectorTransform::*;
+    let flag = match transform {
+        SnakeCase => InflectorCase::Snake,
+        KebabCase => InflectorCase::Kebab,
+        CamelCase => InflectorCase::Camel,
+        ClassCase | PascalCase => InflectorCase::Pascal,
+        ScreamingSnakeCase => InflectorCase::ScreamingSnake,
+        TrainCase => InflectorCase::Train,
+        TitleCase => InflectorCase::Title,
+        SentenceCase => InflectorCase::Sentence,
+        _ => return None,
+    };
+    CASE_STYLES.iter().find(|style| style.flag == flag)
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_pascal_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Pascal) == s)
+
+/// Applies every transform to `s`, writing result `i` to `outputs[i]`. Case
+/// styles are all rendered from a single split of the input into words.
+fn apply_transforms(
+    transforms: &[InflectorTransform],
+    s: &str,
+    acros: &AcronymTable,
+    outputs: &mut [String],
+) {
+    let snake = if round_trips_case(s) {
+        Some(s.to_case(Case::Snake))
+    } else {
+        None
+    };
+    let words = snake.as_deref().map(snake_words);
+    for (transform, output) in transforms.iter().zip(outputs.iter_mut()) {
+        match (transform_style(*transform), &words) {
+            (Some(style), Some(words)) => render_words(words, style, acros, output),
+            _ => *output = apply_transform(*transform, s, acros),
+        }
+    }
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_screamingsnake_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::UpperSnake) == s)
+
+/// Apply each of `transform_count` transforms to rows `start..count` of
+/// `inputs`, writing the results of `transforms[i]` into `arenas[i]`. Rows
+/// that are not set in `validity` are skipped. A null `acronyms` table means
+/// no acronyms.
+///
+/// Returns the number of rows completed, like `cruet_transform_batch`. When a
+/// row does not fit, none of its results are written and `required` is set
+/// on every arena to the size of that row's result for it.
+#[no_mangle]
+pub extern "C" fn cruet_transform_multi_batch(
+    transforms: *const InflectorTransform,
+    transform_count: usize,
+    acronyms: *const InflectorAcronymTable,
+    inputs: *const InflectorString,
+    validity: *const u64,
+    start: usize,
+    count: usize,
+    arenas: *mut InflectorArena,
+) -> usize {
+    if transforms.is_null() || inputs.is_null() || arenas.is_null() || start >= count {
+        return count;
+    }
+    let transforms = unsafe { slice::from_raw_parts(transforms, transform_count) };
+    let inputs = unsafe { slice::from_raw_parts(inputs, count) };
+    let arenas = unsafe { slice::from_raw_parts_mut(arenas, transform_count) };
+    let acronyms = AcronymTable::from_ptr(acronyms);
+
+    let mut outputs = vec![String::new(); transform_count];
+    let mut written = vec![0usize; transform_count];
+    for arena in arenas.iter_mut() {
+        unsafe { *arena.offsets.add(start) = 0 };
+        arena.required = 0;
+    }
+    for row in start..count {
+        if row_is_valid(validity, row) {
+            let input = input_str(&inputs[row]);
+            apply_transforms(transforms, &input, &acronyms, &mut outputs);
+            let fits = arenas
+                .iter()
+                .zip(outputs.iter().zip(written.iter()))
+                .all(|(arena, (output, written))| written + output.len() <= arena.capacity);
+            if !fits {
+                for (arena, output) in arenas.iter_mut().zip(outputs.iter()) {
+                    arena.required = output.len();
+                }
+                return row;
+            }
+            for ((arena, output), written) in
+                arenas.iter().zip(outputs.iter()).zip(written.iter_mut())
+            {
+                unsafe {
+                    ptr::copy_nonoverlapping(
+                        output.as_ptr(),
+                        (arena.data as *mut u8).add(*written),
+                        output.len(),
+                    );
+                }
+                *written += output.len();
+            }
+        }
+        for (arena, written) in arenas.iter().zip(written.iter()) {
+            unsafe { *arena.offsets.add(row + 1) = *written };
+        }
+    }
+    count
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_snake_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Snake) == s)
+
+/// Returns the `InflectorCase` flags of every style `s` is in. The input is
+/// split into words once and every style is rendered from that word list.
+fn detect_cases(s: &str, acros: &AcronymTable, scratch: &mut String) -> u32 {
+    if !round_trips_case(s) {
+        return detect_cases_per_style(s, acros);
+    }
+
+    let snake = s.to_case(Case::Snake);
+    let words = snake_words(&snake);
+
+    let mut cases = 0;
+    for style in CASE_STYLES.iter() {
+        render_words(&words, style, acros, scratch);
+        if scratch == s {
+            cases |= style.flag as u32;
+        }
+    }
+    // Table case and foreign keys are built from the snake case form, so
+    // only a snake case string can already be in either
+    if cases & InflectorCase::Snake as u32 != 0 {
+        if to_plural_with(&snake, acros.plural_rules) == s {
+            cases |= InflectorCase::Table as u32;
+        }
+        if snake.ends_with("_id") {
+            cases |= InflectorCase::ForeignKey as u32;
+        }
+    }
+    cases
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_kebab_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Kebab) == s)
+
+fn detect_cases_per_style(s: &str, acros: &AcronymTable) -> u32 {
+    use InflectorPredicate::*;
+    let predicates = [
+        (SnakeCase, InflectorCase::Snake),
+        (KebabCase, InflectorCase::Kebab),
+        (CamelCase, InflectorCase::Camel),
+        (PascalCase, InflectorCase::Pascal),
+        (ScreamingSnakeCase, InflectorCase::ScreamingSnake),
+        (TrainCase, InflectorCase::Train),
+        (TitleCase, InflectorCase::Title),
+        (SentenceCase, InflectorCase::Sentence),
+        (TableCase, InflectorCase::Table),
+        (ForeignKey, InflectorCase::ForeignKey),
+    ];
+    predicates
+        .iter()
+        .filter(|(predicate, _)| apply_predicate(*predicate, s, acros))
+        .fold(0, |cases, (_, flag)| cases | *flag as u32)
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_train_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Train) == s)
+
+/// Write the `InflectorCase` flags of every style each of `count` rows of
+/// `inputs` is in to `out`. Rows that are not set in `validity` are left
+/// untouched. A null `acronyms` table means no acronyms.
+#[no_mangle]
+pub extern "C" fn cruet_detect_case_batch(
+    acronyms: *const InflectorAcronymTable,
+    inputs: *const InflectorString,
+    validity: *const u64,
+    count: usize,
+    out: *mut u32,
+) {
+    if inputs.is_null() || out.is_null() {
+        return;
+    }
+    let inputs = unsafe { slice::from_raw_parts(inputs, count) };
+    let out = unsafe { slice::from_raw_parts_mut(out, count) };
+    let acronyms = AcronymTable::from_ptr(acronyms);
+    let mut scratch = String::new();
+    for row in 0..count {
+        if row_is_valid(validity, row) {
+            out[row] = detect_cases(&input_str(&inputs[row]), &acronyms, &mut scratch);
+        }
+    }
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_sentence_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Sentence) == s)
+
+fn to_lower_case(s: &str) -> String {
+    s.to_lowercase()
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_title_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| convert_with_acronyms(s, Case::Title) == s)
+
+fn to_upper_case(s: &str) -> String {
+    s.to_uppercase()
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_table_case(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| to_table_case(s) == s)
+
+fn to_table_case(s: &str, rules: Option<&InflectorPluralRules>) -> String {
+    let snake = s.to_case(Case::Snake);
+    to_plural_with(&snake, rules)
 }
-#[no_mangle]
-pub extern "C" fn cruet_is_foreign_key(s: *const c_char) -> c_uchar {
-    predicate_single(s, |s| to_foreign_key(s) == s)
+
+fn to_foreign_key(s: &str) -> String {
+    let snake = s.to_case(Case::Snake);
+    if snake.ends_with("_id") {
+        snake
+    } else {
+        format!("{}_id", snake)
+    }
 }
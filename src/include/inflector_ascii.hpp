@@ -0,0 +1,405 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "rust.h"
+
+namespace duckdb {
+
+//! Immutable snapshot of the acronyms that stay uppercase in capitalized words (see the `inflector_acronyms`
+//! setting), along with the plural rules added by `inflector_irregulars` and `inflector_uncountables`. Taken once at
+//! bind time and shared by all threads executing the bound function.
+struct InflectorAcronyms {
+	InflectorAcronyms();
+	//! `words` must be uppercased and at least two characters long. The plural rules are compiled here, once.
+	explicit InflectorAcronyms(vector<string> words, vector<pair<string, string>> irregulars = {},
+	                           vector<string> uncountables = {});
+	//! Not copyable: `table` points into `words`
+	InflectorAcronyms(const InflectorAcronyms &) = delete;
+	InflectorAcronyms &operator=(const InflectorAcronyms &) = delete;
+
+	//! Sorted bytewise
+	vector<string> words;
+	//! (singular, plural) pairs that override the built-in rules
+	vector<pair<string, string>> irregulars;
+	//! Words whose plural and singular are the word itself
+	vector<string> uncountables;
+	//! Hash of the acronyms and plural rules, identifying the snapshot's contents
+	hash_t fingerprint;
+
+	bool Empty() const {
+		return words.empty();
+	}
+	//! Whether both snapshots hold the same acronyms and plural rules
+	bool Equals(const InflectorAcronyms &other) const {
+		return fingerprint == other.fingerprint && words == other.words && irregulars == other.irregulars &&
+		       uncountables == other.uncountables;
+	}
+	//! Whether an ASCII word matches one of the acronyms, ignoring case
+	bool ContainsAscii(const char *word, idx_t len) const;
+	//! The snapshot in the form passed to Rust
+	const InflectorAcronymTable *Table() const {
+		return &table;
+	}
+
+private:
+	struct FreePluralRules {
+		void operator()(InflectorPluralRules *rules) const {
+			cruet_free_plural_rules(rules);
+		}
+	};
+
+	vector<InflectorString> entries;
+	//! Compiled from `irregulars` and `uncountables`, or nullptr if there are none
+	unique_ptr<InflectorPluralRules, FreePluralRules> plural_rules;
+	InflectorAcronymTable table;
+};
+
+//! ASCII-only implementation of a transform. Writes at most 2 * len bytes to `output` and returns the output length.
+//! Sets `unchanged` if the output equals the input, in which case the caller may reference the input instead.
+typedef idx_t (*inflector_ascii_kernel_t)(const char *input, idx_t len, char *output, const InflectorAcronyms &acronyms,
+                                          bool &unchanged);
+
+//! ASCII-only implementation of a predicate
+typedef bool (*inflector_ascii_predicate_t)(const char *input, idx_t len, const InflectorAcronyms &acronyms);
+
+namespace inflector_ascii {
+
+inline bool IsUpper(char c) {
+	return c >= 'A' && c <= 'Z';
+}
+
+inline bool IsLower(char c) {
+	return c >= 'a' && c <= 'z';
+}
+
+inline bool IsDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+inline bool IsDelimiter(char c) {
+	return c == '_' || c == '-' || c == ' ';
+}
+
+inline char ToUpper(char c) {
+	return IsLower(c) ? char(c - 'a' + 'A') : c;
+}
+
+inline char ToLower(char c) {
+	return IsUpper(c) ? char(c - 'A' + 'a') : c;
+}
+
+//! Returns true if every byte is 7-bit ASCII, checking eight bytes at a time
+inline bool IsAscii(const char *data, idx_t len) {
+	idx_t i = 0;
+	for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+		uint64_t block;
+		memcpy(&block, data + i, sizeof(block));
+		if (block & 0x8080808080808080ULL) {
+			return false;
+		}
+	}
+	for (; i < len; i++) {
+		if (static_cast<unsigned char>(data[i]) & 0x80) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Calls `func(word, word_len)` for every word of an ASCII string, using the default boundaries of the
+//! Rust convert_case crate: '_', '-' and ' ' separate words and are dropped, and a word also ends
+//! between "aA", "a1", "A1", "1a" and "1A", and between the two capitals of "AAa".
+template <class FUNC>
+void ForEachWord(const char *data, idx_t len, FUNC &&func) {
+	idx_t word_start = 0;
+	for (idx_t i = 0; i < len; i++) {
+		auto c = data[i];
+		if (IsDelimiter(c)) {
+			if (i > word_start) {
+				func(data + word_start, i - word_start);
+			}
+			word_start = i + 1;
+			continue;
+		}
+		if (i + 1 == len) {
+			break;
+		}
+		auto next = data[i + 1];
+		bool split;
+		if (IsLower(c)) {
+			split = IsUpper(next) || IsDigit(next);
+		} else if (IsUpper(c)) {
+			split = IsDigit(next) || (IsUpper(next) && i + 2 < len && IsLower(data[i + 2]));
+		} else if (IsDigit(c)) {
+			split = IsUpper(next) || IsLower(next);
+		} else {
+			split = false;
+		}
+		if (split) {
+			func(data + word_start, i + 1 - word_start);
+			word_start = i + 1;
+		}
+	}
+	if (len > word_start) {
+		func(data + word_start, len - word_start);
+	}
+}
+
+enum class WordCase : uint8_t { LOWER, UPPER, CAPITAL };
+
+inline void WriteWord(const char *word, idx_t len, WordCase word_case, char *output) {
+	switch (word_case) {
+	case WordCase::LOWER:
+		for (idx_t i = 0; i < len; i++) {
+			output[i] = ToLower(word[i]);
+		}
+		break;
+	case WordCase::UPPER:
+		for (idx_t i = 0; i < len; i++) {
+			output[i] = ToUpper(word[i]);
+		}
+		break;
+	case WordCase::CAPITAL:
+		output[0] = ToUpper(word[0]);
+		for (idx_t i = 1; i < len; i++) {
+			output[i] = ToLower(word[i]);
+		}
+		break;
+	}
+}
+
+//! Describes how words are rendered for a target case. Words matching an acronym are written in
+//! uppercase where ACRONYMS is set for their position, mirroring `convert_with` in lib.rs.
+template <WordCase FIRST_P, WordCase REST_P, bool FIRST_ACRONYMS_P, bool REST_ACRONYMS_P, char DELIMITER_P>
+struct CaseStyle {
+	static constexpr WordCase FIRST = FIRST_P;
+	static constexpr WordCase REST = REST_P;
+	static constexpr bool FIRST_ACRONYMS = FIRST_ACRONYMS_P;
+	static constexpr bool REST_ACRONYMS = REST_ACRONYMS_P;
+	//! '\0' joins words without a delimiter
+	static constexpr char DELIMITER = DELIMITER_P;
+};
+
+using SnakeCase = CaseStyle<WordCase::LOWER, WordCase::LOWER, false, false, '_'>;
+using KebabCase = CaseStyle<WordCase::LOWER, WordCase::LOWER, false, false, '-'>;
+using ScreamingSnakeCase = CaseStyle<WordCase::UPPER, WordCase::UPPER, false, false, '_'>;
+using CamelCase = CaseStyle<WordCase::LOWER, WordCase::CAPITAL, false, true, '\0'>;
+using PascalCase = CaseStyle<WordCase::CAPITAL, WordCase::CAPITAL, true, true, '\0'>;
+using TrainCase = CaseStyle<WordCase::CAPITAL, WordCase::CAPITAL, true, true, '-'>;
+using TitleCase = CaseStyle<WordCase::CAPITAL, WordCase::CAPITAL, true, true, ' '>;
+using SentenceCase = CaseStyle<WordCase::CAPITAL, WordCase::LOWER, true, true, ' '>;
+
+//! Whether `expected` is `word` rendered in `word_case`
+inline bool MatchWord(const char *word, idx_t len, WordCase word_case, const char *expected) {
+	switch (word_case) {
+	case WordCase::LOWER:
+		for (idx_t i = 0; i < len; i++) {
+			if (expected[i] != ToLower(word[i])) {
+				return false;
+			}
+		}
+		return true;
+	case WordCase::UPPER:
+		for (idx_t i = 0; i < len; i++) {
+			if (expected[i] != ToUpper(word[i])) {
+				return false;
+			}
+		}
+		return true;
+	case WordCase::CAPITAL:
+		if (expected[0] != ToUpper(word[0])) {
+			return false;
+		}
+		for (idx_t i = 1; i < len; i++) {
+			if (expected[i] != ToLower(word[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+//! Whether STYLE renders the word at `word_index` in uppercase when it is an acronym
+template <class STYLE>
+bool UsesAcronyms(idx_t word_index) {
+	return word_index == 0 ? STYLE::FIRST_ACRONYMS : STYLE::REST_ACRONYMS;
+}
+
+//! The case STYLE renders the word at `word_index` in
+template <class STYLE>
+WordCase StyledWordCase(idx_t word_index, bool is_acronym) {
+	if (is_acronym && UsesAcronyms<STYLE>(word_index)) {
+		return WordCase::UPPER;
+	}
+	return word_index == 0 ? STYLE::FIRST : STYLE::REST;
+}
+
+//! Compares the conversion of a string to STYLE against the string itself as the words are fed in, so nothing is
+//! allocated and the comparison can stop at the first difference
+template <class STYLE>
+class CaseMatcher {
+public:
+	CaseMatcher(const char *input_p, idx_t len_p) : input(input_p), len(len_p), position(0), word_index(0) {
+	}
+
+	//! Checks the next word of the input; returns false once the conversion differs from the input
+	bool Word(const char *word, idx_t word_len, bool is_acronym) {
+		if (word_index > 0 && STYLE::DELIMITER != '\0') {
+			if (position >= len || input[position] != STYLE::DELIMITER) {
+				return Mismatch();
+			}
+			position++;
+		}
+		if (position + word_len > len ||
+		    !MatchWord(word, word_len, StyledWordCase<STYLE>(word_index, is_acronym), input + position)) {
+			return Mismatch();
+		}
+		position += word_len;
+		word_index++;
+		return true;
+	}
+
+	//! Whether the conversion matched the whole input, to be called after the last word
+	bool Matches() const {
+		return position == len;
+	}
+
+private:
+	bool Mismatch() {
+		// Past the end of the input, so Matches() is false from here on
+		position = len + 1;
+		return false;
+	}
+
+	const char *input;
+	idx_t len;
+	idx_t position;
+	idx_t word_index;
+};
+
+//! Converts `input` to STYLE, comparing each word against the input while it is written so that a value already in
+//! STYLE is recognized in the same pass
+template <class STYLE>
+idx_t ConvertCase(const char *input, idx_t len, char *output, const InflectorAcronyms &acronyms, bool &unchanged) {
+	CaseMatcher<STYLE> matcher(input, len);
+	bool matches = true;
+	idx_t output_len = 0;
+	idx_t word_index = 0;
+	ForEachWord(input, len, [&](const char *word, idx_t word_len) {
+		if (word_index > 0 && STYLE::DELIMITER != '\0') {
+			output[output_len++] = STYLE::DELIMITER;
+		}
+		bool is_acronym = UsesAcronyms<STYLE>(word_index) && acronyms.ContainsAscii(word, word_len);
+		if (matches) {
+			matches = matcher.Word(word, word_len, is_acronym);
+		}
+		WriteWord(word, word_len, StyledWordCase<STYLE>(word_index, is_acronym), output + output_len);
+		output_len += word_len;
+		word_index++;
+	});
+	unchanged = matches && matcher.Matches();
+	return output_len;
+}
+
+//! Whether converting `input` to STYLE leaves it unchanged
+template <class STYLE>
+bool IsCase(const char *input, idx_t len, const InflectorAcronyms &acronyms) {
+	CaseMatcher<STYLE> matcher(input, len);
+	bool matches = true;
+	idx_t word_index = 0;
+	ForEachWord(input, len, [&](const char *word, idx_t word_len) {
+		if (matches) {
+			bool is_acronym = UsesAcronyms<STYLE>(word_index) && acronyms.ContainsAscii(word, word_len);
+			matches = matcher.Word(word, word_len, is_acronym);
+		}
+		word_index++;
+	});
+	return matches && matcher.Matches();
+}
+
+//! A word of the input, with its acronym lookup done once for all styles
+struct WordSpan {
+	const char *data;
+	idx_t len;
+	bool is_acronym;
+};
+
+template <class STYLE>
+bool WordsMatchCase(const char *input, idx_t len, const vector<WordSpan> &words) {
+	CaseMatcher<STYLE> matcher(input, len);
+	for (auto &word : words) {
+		if (!matcher.Word(word.data, word.len, word.is_acronym)) {
+			return false;
+		}
+	}
+	return matcher.Matches();
+}
+
+//! Splits an ASCII string into `words`, looking every word up in the acronyms
+inline void SplitWords(const char *input, idx_t len, const InflectorAcronyms &acronyms, vector<WordSpan> &words) {
+	words.clear();
+	ForEachWord(input, len, [&](const char *word, idx_t word_len) {
+		words.push_back({word, word_len, acronyms.ContainsAscii(word, word_len)});
+	});
+}
+
+//! Renders words produced by SplitWords in STYLE. Writes at most twice the length of the split string.
+template <class STYLE>
+idx_t RenderWords(const vector<WordSpan> &words, char *output) {
+	idx_t output_len = 0;
+	for (idx_t word_index = 0; word_index < words.size(); word_index++) {
+		auto &word = words[word_index];
+		if (word_index > 0 && STYLE::DELIMITER != '\0') {
+			output[output_len++] = STYLE::DELIMITER;
+		}
+		WriteWord(word.data, word.len, StyledWordCase<STYLE>(word_index, word.is_acronym), output + output_len);
+		output_len += word.len;
+	}
+	return output_len;
+}
+
+//! Returns the InflectorCase flags of every style an ASCII string is in, splitting it into words only once.
+//! `words` is scratch space reused across calls. Table case depends on pluralization and is never set here.
+inline uint32_t DetectCases(const char *input, idx_t len, const InflectorAcronyms &acronyms,
+                            vector<WordSpan> &words) {
+	SplitWords(input, len, acronyms, words);
+
+	uint32_t cases = 0;
+	if (WordsMatchCase<SnakeCase>(input, len, words)) {
+		cases |= InflectorCase_Snake;
+		// A snake case string is its own foreign key when it already ends in "_id"
+		if (len >= 3 && memcmp(input + len - 3, "_id", 3) == 0) {
+			cases |= InflectorCase_ForeignKey;
+		}
+	}
+	if (WordsMatchCase<KebabCase>(input, len, words)) {
+		cases |= InflectorCase_Kebab;
+	}
+	if (WordsMatchCase<CamelCase>(input, len, words)) {
+		cases |= InflectorCase_Camel;
+	}
+	if (WordsMatchCase<PascalCase>(input, len, words)) {
+		cases |= InflectorCase_Pascal;
+	}
+	if (WordsMatchCase<ScreamingSnakeCase>(input, len, words)) {
+		cases |= InflectorCase_ScreamingSnake;
+	}
+	if (WordsMatchCase<TrainCase>(input, len, words)) {
+		cases |= InflectorCase_Train;
+	}
+	if (WordsMatchCase<TitleCase>(input, len, words)) {
+		cases |= InflectorCase_Title;
+	}
+	if (WordsMatchCase<SentenceCase>(input, len, words)) {
+		cases |= InflectorCase_Sentence;
+	}
+	return cases;
+}
+
+} // namespace inflector_ascii
+
+//! ASCII-only implementation of a transform for a string that was already split with SplitWords
+typedef idx_t (*inflector_ascii_renderer_t)(const vector<inflector_ascii::WordSpan> &words, char *output);
+
+} // namespace duckdb
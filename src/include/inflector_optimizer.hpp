@@ -0,0 +1,13 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! Replaces every inflect(format, subquery) table function in a plan with a projection of the subquery's columns.
+//! The columns were already renamed when the table function was bound, so this only removes the optimizer barrier:
+//! filters, column pruning and row group pruning reach the scans in the subquery.
+void InflectorPreOptimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+
+} // namespace duckdb
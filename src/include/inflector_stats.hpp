@@ -0,0 +1,139 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "rust.h"
+
+#include <chrono>
+
+namespace duckdb {
+
+//! Work done by one inflector function, reported by inflector_stats(). Values converted once for a whole constant or
+//! dictionary vector count their bytes once, but every row counts towards `rows`.
+struct InflectorCounters {
+	//! Chunks evaluated
+	idx_t calls = 0;
+	idx_t rows = 0;
+	idx_t nulls = 0;
+	idx_t input_bytes = 0;
+	idx_t output_bytes = 0;
+	//! Size of the result buffers allocated
+	idx_t allocated_bytes = 0;
+	//! Time spent evaluating the function, including the time below
+	idx_t nanos = 0;
+	//! Calls into the Rust library, and the time spent in them
+	idx_t ffi_calls = 0;
+	idx_t ffi_nanos = 0;
+	//! Time spent removing diacritics with strip_accents
+	idx_t strip_accents_nanos = 0;
+	//! Chunks that failed with an error
+	idx_t errors = 0;
+	idx_t cache_hits = 0;
+	idx_t cache_misses = 0;
+	//! Cache entries dropped because the cache was full or the function was bound differently
+	idx_t cache_evictions = 0;
+	//! Rows returned without copying because the transform left them unchanged
+	idx_t passthrough = 0;
+
+	void Add(const InflectorCounters &other);
+	void Subtract(const InflectorCounters &other);
+};
+
+//! Identifies the function that counters belong to: one slot per transform and predicate, followed by
+//! inflector_detect_case and inflect_all
+struct InflectorStatsSlot {
+	static idx_t Transform(InflectorTransform transform);
+	static idx_t Predicate(InflectorPredicate predicate);
+	static idx_t DetectCase();
+	static idx_t InflectAll();
+	static constexpr idx_t COUNT = 32;
+
+	//! SQL name of the function counted in `slot`
+	static const char *Name(idx_t slot);
+};
+
+struct InflectorStatsRegistry;
+
+//! Counters of one function in one thread's execution state. The owning thread adds to them once per chunk, which
+//! only takes an uncontended lock; inflector_stats() merges the shards of all threads when it is read. A destroyed
+//! shard hands its counts over to the process-wide totals.
+class InflectorStatsShard {
+public:
+	explicit InflectorStatsShard(idx_t slot);
+	~InflectorStatsShard();
+
+	void Add(const InflectorCounters &chunk);
+
+	//! Counters of every function since the last inflector_reset_stats(), indexed by slot
+	static vector<InflectorCounters> GetStatistics();
+	//! Restarts all counters from zero
+	static void Reset();
+
+private:
+	//! Totals of all shards ever created; the registry lock must be held
+	static vector<InflectorCounters> GetTotals(InflectorStatsRegistry &registry);
+
+	idx_t slot;
+	mutex lock;
+	InflectorCounters counters;
+};
+
+//! Counters of one inflector expression in a profiled query
+struct InflectorExpressionCounters {
+	//! The expression as it is shown in the query plan, e.g. `inflector_to_snake_case(name)`
+	string expression;
+	string function_name;
+	InflectorCounters counters;
+};
+
+//! Counters of one expression, shared by all threads evaluating it
+struct InflectorProfileEntry {
+	//! The expression of the plan, only compared and never dereferenced
+	const BoundFunctionExpression *expr = nullptr;
+	mutex lock;
+	InflectorExpressionCounters data;
+};
+
+//! Per-expression counters of the inflector functions in the last profiled query of a connection, reported by
+//! inflector_profile(). Expressions are only counted while the query profiler is enabled, e.g. under EXPLAIN ANALYZE
+//! or PRAGMA enable_profiling, so that the numbers can be read next to the operator timings.
+class InflectorProfile : public ClientContextState {
+public:
+	//! Returns the counters of `expr` in the current query, or nullptr if the query is not being profiled
+	static shared_ptr<InflectorProfileEntry> Register(ClientContext &context, const BoundFunctionExpression &expr);
+	//! Counters of the last profiled query that evaluated inflector functions, in the order they were first evaluated.
+	//! Each expression of the plan has its own entry, even if another one prints the same.
+	static vector<InflectorExpressionCounters> GetLastQuery(ClientContext &context);
+
+	void QueryEnd(ClientContext &context) override;
+
+private:
+	mutex lock;
+	vector<shared_ptr<InflectorProfileEntry>> current_query;
+	vector<shared_ptr<InflectorProfileEntry>> last_query;
+};
+
+//! Time spent in each phase of the last LOAD of the extension, reported by inflector_load_timings()
+struct InflectorLoadTimings {
+	static void Set(vector<pair<string, idx_t>> phases);
+	static vector<pair<string, idx_t>> Get();
+};
+
+//! Measures the time spent in a scope, adding it to a counter when it ends
+class InflectorStatsTimer {
+public:
+	explicit InflectorStatsTimer(idx_t &nanos_p) : nanos(nanos_p), start(std::chrono::steady_clock::now()) {
+	}
+	~InflectorStatsTimer() {
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		nanos += UnsafeNumericCast<idx_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+	}
+
+private:
+	idx_t &nanos;
+	std::chrono::steady_clock::time_point start;
+};
+
+} // namespace duckdb
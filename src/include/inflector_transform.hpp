@@ -0,0 +1,227 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+#include "duckdb/execution/expression_executor_state.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "inflector_ascii.hpp"
+#include "inflector_stats.hpp"
+#include "rust.h"
+
+namespace duckdb {
+
+//! Everything needed to execute a transform, resolved once at bind time
+struct InflectorTransformBindData : public FunctionData {
+	explicit InflectorTransformBindData(InflectorTransform transform_func_p, bool strip_accents_p = false);
+
+	InflectorTransform transform_func;
+	bool strip_accents;
+	//! C++ implementation used for ASCII-only values, or nullptr to always call into Rust
+	inflector_ascii_kernel_t ascii_kernel;
+	//! Acronyms in effect when the function was bound
+	shared_ptr<InflectorAcronyms> acronyms;
+	//! Maximum number of results memoized per thread (`inflector_cache_size`), 0 disables the cache
+	idx_t cache_size;
+
+	//! Resolves the ASCII kernel, acronyms and cache size for a transform from the current settings
+	static unique_ptr<InflectorTransformBindData> Create(ClientContext &context, InflectorTransform transform_func,
+	                                                     bool strip_accents = false);
+	//! Applies the transform to a single value, in C++ when it is ASCII-only
+	string Transform(const string &input) const;
+
+	unique_ptr<FunctionData> Copy() const override;
+	bool Equals(const FunctionData &other_p) const override;
+};
+
+//! Everything needed to evaluate a predicate, resolved once at bind time
+struct InflectorPredicateBindData : public FunctionData {
+	explicit InflectorPredicateBindData(InflectorPredicate predicate_p);
+
+	InflectorPredicate predicate;
+	//! C++ implementation used for ASCII-only values, or nullptr to always call into Rust
+	inflector_ascii_predicate_t ascii_predicate;
+	//! Acronyms in effect when the function was bound
+	shared_ptr<InflectorAcronyms> acronyms;
+
+	//! Resolves the ASCII classifier and acronyms for a predicate from the current settings
+	static unique_ptr<InflectorPredicateBindData> Create(ClientContext &context, InflectorPredicate predicate);
+
+	unique_ptr<FunctionData> Copy() const override;
+	bool Equals(const FunctionData &other_p) const override;
+};
+
+//! Acronyms and fast path setting for inflector_detect_case, resolved once at bind time
+struct InflectorDetectCaseBindData : public FunctionData {
+	InflectorDetectCaseBindData(bool ascii_fast_path_p, shared_ptr<InflectorAcronyms> acronyms_p);
+
+	//! Whether ASCII-only values are classified in C++
+	bool ascii_fast_path;
+	//! Acronyms in effect when the function was bound
+	shared_ptr<InflectorAcronyms> acronyms;
+
+	static unique_ptr<InflectorDetectCaseBindData> Create(ClientContext &context);
+
+	unique_ptr<FunctionData> Copy() const override;
+	bool Equals(const FunctionData &other_p) const override;
+};
+
+//! Everything needed to execute inflect_all, resolved once at bind time
+struct InflectAllBindData : public FunctionData {
+	InflectAllBindData(vector<InflectorTransform> transforms_p, bool ascii_fast_path_p,
+	                   shared_ptr<InflectorAcronyms> acronyms_p);
+
+	//! Transform producing each field of the result STRUCT
+	vector<InflectorTransform> transforms;
+	//! Whether ASCII-only values are converted in C++
+	bool ascii_fast_path;
+	//! Acronyms in effect when the function was bound
+	shared_ptr<InflectorAcronyms> acronyms;
+
+	//! `include_number` adds the plural and singular fields
+	static unique_ptr<InflectAllBindData> Create(ClientContext &context, bool include_number);
+
+	unique_ptr<FunctionData> Copy() const override;
+	bool Equals(const FunctionData &other_p) const override;
+};
+
+//! Totals of all per-thread transform caches, summed over the counters of every function in inflector_stats(), so
+//! inflector_reset_stats() restarts them too
+struct InflectorCacheStatistics {
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+	//! Rows returned without copying because the transform left them unchanged
+	idx_t passthrough;
+};
+
+//! Bounded memo of transform results, keyed by the input bytes. All entries were produced under the same
+//! (transform, strip_accents, acronyms); binding a different configuration starts from an empty cache.
+class InflectorCache {
+public:
+	explicit InflectorCache(idx_t capacity);
+
+	//! Drops all entries if they were produced under a different configuration than `bind_data`
+	void Prepare(const InflectorTransformBindData &bind_data);
+	//! Looks up the result for `input`, returning false on a miss. The result points into the cache's heap.
+	bool Lookup(const string_t &input, string_t &output);
+	//! Makes `result` keep the heap that the results of Lookup point into alive
+	void KeepAlive(Vector &result);
+	//! Memoizes a result. When the cache is full, all entries are evicted first.
+	void Insert(const string_t &input, const string_t &output);
+	//! Adds the hits, misses and evictions counted since the last flush to the counters of the current chunk
+	void FlushStatistics(InflectorCounters &counters);
+
+	static InflectorCacheStatistics GetStatistics();
+
+private:
+	//! Evicts all entries
+	void Clear();
+
+	idx_t capacity;
+	InflectorTransform transform_func;
+	bool strip_accents;
+	hash_t acronym_fingerprint;
+	//! Keys and values point into `heap`. Result vectors answered from the cache keep a reference to it instead of
+	//! copying the values, so an eviction starts a new heap rather than clearing this one.
+	string_map_t<string_t> entries;
+	buffer_ptr<VectorStringBuffer> heap;
+
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+};
+
+//! Process-wide, size-bounded memo of the names and types computed when inflect() is bound, so re-binding a query
+//! over a wide table does not transform every column name again. Entries are keyed by everything a result depends
+//! on (transform, strip_accents, acronyms and input), so they never need to be invalidated.
+class InflectorBindCache {
+public:
+	//! Cached InflectorTransformString
+	static string TransformName(InflectorTransform transform, const InflectorAcronyms &acronyms, const string &name,
+	                            bool strip_accents);
+	//! Returns the inflected form of `type`, calling `inflect` on a miss
+	static LogicalType InflectType(InflectorTransform transform, const InflectorAcronyms &acronyms,
+	                               const LogicalType &type, bool strip_accents,
+	                               const std::function<LogicalType()> &inflect);
+};
+
+//! Per-thread execution state shared by all inflector scalar functions
+struct InflectorLocalState : public FunctionLocalState {
+	//! Id of the dictionary whose transformed entries are held in `dictionary`
+	string dictionary_id;
+	//! Results for every entry of the last dictionary vector seen
+	unique_ptr<Vector> dictionary;
+	//! Memoized transform results, only present for transforms bound with a non-zero `inflector_cache_size`
+	unique_ptr<InflectorCache> cache;
+	//! Scratch space for splitting values into words
+	vector<inflector_ascii::WordSpan> words;
+	//! This thread's share of the inflector_stats() counters, created on the first chunk
+	unique_ptr<InflectorStatsShard> stats;
+	//! Counters of this expression in the current query when it is being profiled, nullptr otherwise
+	shared_ptr<InflectorProfileEntry> profile;
+
+	//! Adds the counters of a chunk to this thread's statistics for the function in `slot`, and to the profile
+	void AddStatistics(idx_t slot, const InflectorCounters &chunk);
+
+	static unique_ptr<FunctionLocalState> Init(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                           FunctionData *bind_data);
+	//! Also sets up the cache; `bind_data` must be an InflectorTransformBindData
+	static unique_ptr<FunctionLocalState> InitTransform(ExpressionState &state, const BoundFunctionExpression &expr,
+	                                                    FunctionData *bind_data);
+};
+
+//! Takes a snapshot of the `inflector_acronyms`, `inflector_irregulars` and `inflector_uncountables` settings as seen
+//! by a connection
+shared_ptr<InflectorAcronyms> InflectorGetAcronyms(ClientContext &context);
+
+//! Returns the C++ ASCII classifier for a predicate, or nullptr if it is only implemented in Rust
+inflector_ascii_predicate_t InflectorGetAsciiPredicate(InflectorPredicate predicate);
+
+//! Returns the C++ ASCII renderer for a case transform, or nullptr if it is only implemented in Rust
+inflector_ascii_renderer_t InflectorGetAsciiRenderer(InflectorTransform transform);
+
+//! Removes diacritics from a UTF-8 string
+string StripAccentsString(const string &input);
+
+//! Returns the C++ ASCII kernel for a transform, or nullptr if it is only implemented in Rust
+inflector_ascii_kernel_t InflectorGetAsciiKernel(InflectorTransform transform);
+
+//! Applies a transform to a single string, e.g. a column or struct field name
+string InflectorTransformString(InflectorTransform transform, const InflectorAcronyms &acronyms, const string &input,
+                                bool strip_accents = false);
+
+//! Applies a bound transform to a VARCHAR vector, crossing the FFI boundary at most once per chunk. Constant and
+//! dictionary vectors are transformed once per distinct value.
+void InflectorExecuteTransform(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate,
+                               Vector &input, Vector &result, idx_t count);
+
+//! Evaluates a predicate on a VARCHAR vector, crossing the FFI boundary at most once per chunk. Constant and
+//! dictionary vectors are evaluated once per distinct value.
+void InflectorExecutePredicate(const InflectorPredicateBindData &bind_data, InflectorLocalState &lstate,
+                               Vector &input, Vector &result, idx_t count);
+
+//! Rewrites the object keys of a JSON vector with a bound transform, copying everything else verbatim
+void InflectorExecuteJson(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate, Vector &input,
+                          Vector &result, idx_t count);
+
+//! Replaces the VARCHAR `keys` of a MAP vector with their transformed form, transforming each distinct key of the
+//! chunk only once. The values are not touched. A map in which two keys would become equal keeps its original keys.
+void InflectorTransformMapKeys(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate, Vector &map,
+                               Vector &keys, idx_t count);
+
+//! STRUCT with one BOOLEAN field per case style, returned by inflector_detect_case
+LogicalType InflectorDetectCaseType();
+
+//! Determines every case style the values of a VARCHAR vector are in, writing one STRUCT of booleans per row
+void InflectorExecuteDetectCase(const InflectorDetectCaseBindData &bind_data, InflectorLocalState &lstate,
+                                Vector &input, Vector &result, idx_t count);
+
+//! STRUCT with one VARCHAR field per case style, and optionally the plural and singular, returned by inflect_all
+LogicalType InflectAllType(bool include_number);
+
+//! Renders every field of inflect_all for the values of a VARCHAR vector, splitting each value into words once
+void InflectorExecuteInflectAll(const InflectAllBindData &bind_data, InflectorLocalState &lstate, Vector &input,
+                                Vector &result, idx_t count);
+
+} // namespace duckdb
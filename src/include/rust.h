@@ -2,91 +2,198 @@
 
 /* This file is automatically generated by cbindgen. */
 
+#pragma once
+
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
-extern "C" {
 /**
- * Set acronyms from a comma-separated string. Tokens are uppercased.
- * Single-character tokens are silently ignored (minimum 2 chars).
+ * Transforms that can be applied with `cruet_transform_batch`.
  */
-void cruet_set_acronyms(const char *csv);
+typedef enum InflectorTransform {
+  InflectorTransform_ClassCase,
+  InflectorTransform_CamelCase,
+  InflectorTransform_PascalCase,
+  InflectorTransform_ScreamingSnakeCase,
+  InflectorTransform_SnakeCase,
+  InflectorTransform_KebabCase,
+  InflectorTransform_TrainCase,
+  InflectorTransform_SentenceCase,
+  InflectorTransform_TitleCase,
+  InflectorTransform_UpperCase,
+  InflectorTransform_LowerCase,
+  InflectorTransform_TableCase,
+  InflectorTransform_Ordinalize,
+  InflectorTransform_Deordinalize,
+  InflectorTransform_ForeignKey,
+  InflectorTransform_Demodulize,
+  InflectorTransform_Deconstantize,
+  InflectorTransform_Plural,
+  InflectorTransform_Singular,
+} InflectorTransform;
 
 /**
- * Get the current acronyms as a sorted comma-separated string.
- * Caller must free the returned string with `free_c_string`.
+ * Predicates that can be applied with `cruet_predicate_batch`.
  */
-char *cruet_get_acronyms(void);
+typedef enum InflectorPredicate {
+  InflectorPredicate_ClassCase,
+  InflectorPredicate_CamelCase,
+  InflectorPredicate_PascalCase,
+  InflectorPredicate_ScreamingSnakeCase,
+  InflectorPredicate_SnakeCase,
+  InflectorPredicate_KebabCase,
+  InflectorPredicate_TrainCase,
+  InflectorPredicate_SentenceCase,
+  InflectorPredicate_TitleCase,
+  InflectorPredicate_TableCase,
+  InflectorPredicate_ForeignKey,
+} InflectorPredicate;
 
 /**
- * Clear all configured acronyms, restoring default behavior.
+ * Flags returned by `cruet_detect_case_batch`, one per case style.
  */
-void cruet_clear_acronyms(void);
+typedef enum InflectorCase {
+  InflectorCase_Snake = 1,
+  InflectorCase_Kebab = 2,
+  InflectorCase_Camel = 4,
+  InflectorCase_Pascal = 8,
+  InflectorCase_ScreamingSnake = 16,
+  InflectorCase_Train = 32,
+  InflectorCase_Title = 64,
+  InflectorCase_Sentence = 128,
+  InflectorCase_Table = 256,
+  InflectorCase_ForeignKey = 512,
+} InflectorCase;
 
 /**
- * Free a single C string returned by the transform functions
+ * Irregular plurals and uncountable words added on top of cruet's rules,
+ * keyed by their lowercase form. Compiled once per query by
+ * `cruet_compile_plural_rules` and only read afterwards, so threads share
+ * it without locking.
  */
-void free_c_string(char *s);
-
-char *cruet_to_class_case(const char *s);
-
-char *cruet_to_camel_case(const char *s);
-
-char *cruet_to_pascal_case(const char *s);
-
-char *cruet_to_screamingsnake_case(const char *s);
-
-char *cruet_to_snake_case(const char *s);
-
-char *cruet_to_kebab_case(const char *s);
-
-char *cruet_to_train_case(const char *s);
-
-char *cruet_to_sentence_case(const char *s);
-
-char *cruet_to_title_case(const char *s);
-
-char *cruet_to_upper_case(const char *s);
-
-char *cruet_to_lower_case(const char *s);
-
-char *cruet_to_table_case(const char *s);
-
-char *cruet_ordinalize(const char *s);
-
-char *cruet_deordinalize(const char *s);
-
-char *cruet_to_foreign_key(const char *s);
-
-char *cruet_demodulize(const char *s);
-
-char *cruet_deconstantize(const char *s);
-
-char *cruet_to_plural(const char *s);
-
-char *cruet_to_singular(const char *s);
+typedef struct InflectorPluralRules InflectorPluralRules;
 
-unsigned char cruet_is_class_case(const char *s);
-
-unsigned char cruet_is_camel_case(const char *s);
-
-unsigned char cruet_is_pascal_case(const char *s);
+/**
+ * A borrowed string passed by pointer and length. It does not need to be
+ * NUL terminated.
+ */
+typedef struct InflectorString {
+  const char *data;
+  uintptr_t len;
+} InflectorString;
 
-unsigned char cruet_is_screamingsnake_case(const char *s);
+/**
+ * Acronyms resolved by the caller when a query is bound: uppercased, at
+ * least two characters long and sorted bytewise. The table is immutable
+ * for the duration of a call, so lookups take no locks.
+ *
+ * The plural rules compiled for the same query travel along with it; null
+ * means cruet's rules only.
+ */
+typedef struct InflectorAcronymTable {
+  const InflectorString *words;
+  uintptr_t count;
+  const InflectorPluralRules *plural_rules;
+} InflectorAcronymTable;
 
-unsigned char cruet_is_snake_case(const char *s);
+/**
+ * Caller-owned output arena for `cruet_transform_batch`.
+ *
+ * Results are written back to back into `data` without NUL terminators.
+ * `offsets` must hold `count + 1` entries; row `i` occupies
+ * `data[offsets[i]..offsets[i + 1]]` (an empty range for NULL rows).
+ */
+typedef struct InflectorArena {
+  char *data;
+  uintptr_t capacity;
+  uintptr_t *offsets;
+  /**
+   * Set to the size of the first result that did not fit, 0 otherwise.
+   */
+  uintptr_t required;
+} InflectorArena;
 
-unsigned char cruet_is_kebab_case(const char *s);
+extern "C" {
+/**
+ * Compile `irregular_count` (singular, plural) pairs, stored back to back in
+ * `irregulars`, and `uncountable_count` uncountable words into rules for
+ * `InflectorAcronymTable::plural_rules`. Release them with
+ * `cruet_free_plural_rules`.
+ */
+InflectorPluralRules *cruet_compile_plural_rules(const InflectorString *irregulars,
+                                                 uintptr_t irregular_count,
+                                                 const InflectorString *uncountables,
+                                                 uintptr_t uncountable_count);
 
-unsigned char cruet_is_train_case(const char *s);
+/**
+ * Free rules returned by `cruet_compile_plural_rules`
+ */
+void cruet_free_plural_rules(InflectorPluralRules *rules);
 
-unsigned char cruet_is_sentence_case(const char *s);
+/**
+ * Apply `transform` to rows `start..count` of `inputs`, writing the results
+ * into `arena`. Rows that are not set in `validity` are skipped. A null
+ * `acronyms` table means no acronyms.
+ *
+ * If `unchanged` is not null it must be a zeroed bit mask like `validity`.
+ * Rows whose result equals their input are then flagged in it instead of
+ * being copied, and occupy an empty range of the arena.
+ *
+ * Returns the number of rows completed (always counted from row 0). When it
+ * is less than `count` the next result did not fit in the arena: its size is
+ * stored in `arena.required` and the caller should resume from the returned
+ * row with a larger arena.
+ */
+uintptr_t cruet_transform_batch(InflectorTransform transform,
+                                const InflectorAcronymTable *acronyms,
+                                const InflectorString *inputs,
+                                const uint64_t *validity,
+                                uintptr_t start,
+                                uintptr_t count,
+                                InflectorArena *arena,
+                                uint64_t *unchanged);
 
-unsigned char cruet_is_title_case(const char *s);
+/**
+ * Apply `predicate` to `count` rows of `inputs`, writing one bool per row to
+ * `out`. Rows that are not set in `validity` are left untouched, so the
+ * caller can fill them in itself. A null `acronyms` table means no acronyms.
+ */
+void cruet_predicate_batch(InflectorPredicate predicate,
+                           const InflectorAcronymTable *acronyms,
+                           const InflectorString *inputs,
+                           const uint64_t *validity,
+                           uintptr_t count,
+                           bool *out);
 
-unsigned char cruet_is_table_case(const char *s);
+/**
+ * Apply each of `transform_count` transforms to rows `start..count` of
+ * `inputs`, writing the results of `transforms[i]` into `arenas[i]`. Rows
+ * that are not set in `validity` are skipped. A null `acronyms` table means
+ * no acronyms.
+ *
+ * Returns the number of rows completed, like `cruet_transform_batch`. When a
+ * row does not fit, none of its results are written and `required` is set
+ * on every arena to the size of that row's result for it.
+ */
+uintptr_t cruet_transform_multi_batch(const InflectorTransform *transforms,
+                                      uintptr_t transform_count,
+                                      const InflectorAcronymTable *acronyms,
+                                      const InflectorString *inputs,
+                                      const uint64_t *validity,
+                                      uintptr_t start,
+                                      uintptr_t count,
+                                      InflectorArena *arenas);
 
-unsigned char cruet_is_foreign_key(const char *s);
+/**
+ * Write the `InflectorCase` flags of every style each of `count` rows of
+ * `inputs` is in to `out`. Rows that are not set in `validity` are left
+ * untouched. A null `acronyms` table means no acronyms.
+ */
+void cruet_detect_case_batch(const InflectorAcronymTable *acronyms,
+                             const InflectorString *inputs,
+                             const uint64_t *validity,
+                             uintptr_t count,
+                             uint32_t *out);
 }
\ No newline at end of file
@@ -3,47 +3,54 @@
 #include "inflector_extension.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/comparison_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
 #include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
 #include <duckdb/parser/parsed_data/create_table_function_info.hpp>
 #include <duckdb/execution/expression_executor.hpp>
 #include <duckdb/planner/expression/bound_function_expression.hpp>
 #include "rust.h"
+#include "inflector_transform.hpp"
+#include "inflector_optimizer.hpp"
 #include "query_farm_telemetry.hpp"
-#include "utf8proc.hpp"
 
 namespace duckdb {
 
-static std::string StripAccentsString(const std::string &input) {
-	auto stripped = utf8proc_remove_accents((const utf8proc_uint8_t *)input.c_str(),
-	                                        (utf8proc_ssize_t)input.size());
-	std::string result((const char *)stripped);
-	free(stripped);
-	return result;
+static void InflectorTransformFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<InflectorTransformBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<InflectorLocalState>();
+	InflectorExecuteTransform(bind_data, lstate, args.data[0], result, args.size());
 }
 
-// Generic helper for string transformations with documentation
-inline void RegisterInflectorTransform(ExtensionLoader &loader, const char *sql_name,
-                                       char *(*cruet_func)(const char *), const char *description,
-                                       const char *example, const char *param_name,
-                                       vector<string> categories) {
-	auto fun_impl = [cruet_func](DataChunk &args, ExpressionState &state, Vector &result) {
-		auto &name_vector = args.data[0];
-		UnaryExecutor::Execute<string_t, string_t>(
-		    name_vector, result, args.size(), [cruet_func, &result](string_t name) -> string_t {
-			    auto value = name.GetString();
-			    char *change_result = cruet_func(value.c_str());
-			    if (!change_result) {
-				    throw InternalException("Inflector transform returned null - memory allocation failed");
-			    }
-			    string_t return_result = StringVector::AddString(result, change_result);
-			    free_c_string(change_result);
-			    return return_result;
-		    });
-	};
+template <InflectorTransform TRANSFORM>
+static unique_ptr<FunctionData> InflectorTransformBind(ClientContext &context, ScalarFunction &bound_function,
+                                                       vector<unique_ptr<Expression>> &arguments) {
+	return InflectorTransformBindData::Create(context, TRANSFORM);
+}
 
-	ScalarFunction fun(sql_name, {LogicalType::VARCHAR}, LogicalType::VARCHAR, fun_impl);
+// Generic helper for string transformations with documentation
+template <InflectorTransform TRANSFORM>
+inline void RegisterInflectorTransform(ExtensionLoader &loader, const char *sql_name, const char *description,
+                                       const char *example, const char *param_name, vector<string> categories) {
+	ScalarFunction fun(sql_name, {LogicalType::VARCHAR}, LogicalType::VARCHAR, InflectorTransformFunc,
+	                   InflectorTransformBind<TRANSFORM>);
+	fun.init_local_state = InflectorLocalState::InitTransform;
 	CreateScalarFunctionInfo info(fun);
 
 	FunctionDescription func_desc;
@@ -57,20 +64,26 @@ inline void RegisterInflectorTransform(ExtensionLoader &loader, const char *sql_
 	loader.RegisterFunction(info);
 }
 
-// Generic helper for boolean predicates with documentation
-inline void RegisterInflectorPredicate(ExtensionLoader &loader, const char *sql_name,
-                                       unsigned char (*cruet_func)(const char *), const char *description,
-                                       const char *example, const char *param_name,
-                                       vector<string> categories) {
-	auto fun_impl = [cruet_func](DataChunk &args, ExpressionState &state, Vector &result) {
-		auto &name_vector = args.data[0];
-		UnaryExecutor::Execute<string_t, bool>(name_vector, result, args.size(), [cruet_func](string_t name) -> bool {
-			auto value = name.GetString();
-			return static_cast<bool>(cruet_func(value.c_str()));
-		});
-	};
+static void InflectorPredicateFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<InflectorPredicateBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<InflectorLocalState>();
+	InflectorExecutePredicate(bind_data, lstate, args.data[0], result, args.size());
+}
+
+template <InflectorPredicate PREDICATE>
+static unique_ptr<FunctionData> InflectorPredicateBind(ClientContext &context, ScalarFunction &bound_function,
+                                                       vector<unique_ptr<Expression>> &arguments) {
+	return InflectorPredicateBindData::Create(context, PREDICATE);
+}
 
-	ScalarFunction fun(sql_name, {LogicalType::VARCHAR}, LogicalType::BOOLEAN, fun_impl);
+// Generic helper for boolean predicates with documentation
+template <InflectorPredicate PREDICATE>
+inline void RegisterInflectorPredicate(ExtensionLoader &loader, const char *sql_name, const char *description,
+                                       const char *example, const char *param_name, vector<string> categories) {
+	ScalarFunction fun(sql_name, {LogicalType::VARCHAR}, LogicalType::BOOLEAN, InflectorPredicateFunc,
+	                   InflectorPredicateBind<PREDICATE>);
+	fun.init_local_state = InflectorLocalState::Init;
 	CreateScalarFunctionInfo info(fun);
 
 	FunctionDescription func_desc;
@@ -84,6 +97,192 @@ inline void RegisterInflectorPredicate(ExtensionLoader &loader, const char *sql_
 	loader.RegisterFunction(info);
 }
 
+// English ordinal suffix of a number, given its last two digits
+static const char *OrdinalSuffix(uint64_t last_two_digits) {
+	if (last_two_digits >= 11 && last_two_digits <= 13) {
+		return "th";
+	}
+	switch (last_two_digits % 10) {
+	case 1:
+		return "st";
+	case 2:
+		return "nd";
+	case 3:
+		return "rd";
+	default:
+		return "th";
+	}
+}
+
+// Formats a number and its ordinal suffix straight into the result, where it is inlined if it fits in a string_t
+static string_t OrdinalizeInteger(uint64_t magnitude, bool negative, Vector &result) {
+	char buffer[24];
+	auto end = buffer + sizeof(buffer);
+	auto begin = end - 2;
+	memcpy(begin, OrdinalSuffix(magnitude % 100), 2);
+	do {
+		*--begin = static_cast<char>('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+	if (negative) {
+		*--begin = '-';
+	}
+	return StringVector::AddString(result, begin, UnsafeNumericCast<idx_t>(end - begin));
+}
+
+static void InflectorOrdinalizeBigintFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<int64_t, string_t>(args.data[0], result, args.size(), [&](int64_t value) {
+		auto magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+		return OrdinalizeInteger(magnitude, value < 0, result);
+	});
+}
+
+static void InflectorOrdinalizeHugeintFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<hugeint_t, string_t>(args.data[0], result, args.size(), [&](hugeint_t value) {
+		int64_t small_value;
+		if (Hugeint::TryCast<int64_t>(value, small_value)) {
+			auto magnitude =
+			    small_value < 0 ? 0 - static_cast<uint64_t>(small_value) : static_cast<uint64_t>(small_value);
+			return OrdinalizeInteger(magnitude, small_value < 0, result);
+		}
+		auto text = Hugeint::ToString(value);
+		auto last_two_digits = static_cast<uint64_t>((text[text.size() - 2] - '0') * 10 + text.back() - '0');
+		text += OrdinalSuffix(last_two_digits);
+		return StringVector::AddString(result, text);
+	});
+}
+
+// Parses an integer with an optional ordinal suffix in any case, e.g. '21st', '22ND' or '-3'. Returns false if the
+// suffix is not the one inflector_ordinalize gives the number (e.g. '1th'), or if the string is anything else or
+// does not fit in a BIGINT.
+static bool TryDeordinalize(const string_t &input, int64_t &result) {
+	auto data = input.GetData();
+	auto len = input.GetSize();
+	string suffix;
+	if (len >= 2 && !inflector_ascii::IsDigit(data[len - 1])) {
+		suffix = StringUtil::Lower(string(data + len - 2, 2));
+		len -= 2;
+	}
+	idx_t pos = 0;
+	bool negative = false;
+	if (pos < len && (data[pos] == '-' || data[pos] == '+')) {
+		negative = data[pos] == '-';
+		pos++;
+	}
+	if (pos == len) {
+		return false;
+	}
+	uint64_t magnitude = 0;
+	for (; pos < len; pos++) {
+		if (!inflector_ascii::IsDigit(data[pos])) {
+			return false;
+		}
+		auto digit = static_cast<uint64_t>(data[pos] - '0');
+		if (magnitude > (NumericLimits<uint64_t>::Maximum() - digit) / 10) {
+			return false;
+		}
+		magnitude = magnitude * 10 + digit;
+	}
+	auto limit = static_cast<uint64_t>(NumericLimits<int64_t>::Maximum()) + (negative ? 1 : 0);
+	if (magnitude > limit) {
+		return false;
+	}
+	if (!suffix.empty() && suffix != OrdinalSuffix(magnitude % 100)) {
+		return false;
+	}
+	result = negative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+	return true;
+}
+
+static void InflectorDeordinalizeBigintFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::ExecuteWithNulls<string_t, int64_t>(
+	    args.data[0], result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    int64_t value = 0;
+		    if (!TryDeordinalize(input, value)) {
+			    mask.SetInvalid(idx);
+		    }
+		    return value;
+	    });
+}
+
+// inflector_ordinalize accepts numbers as text, or integers formatted without a round trip through a string
+static void RegisterInflectorOrdinalize(ExtensionLoader &loader) {
+	ScalarFunctionSet ordinalize_set("inflector_ordinalize");
+	ScalarFunction varchar_function({LogicalType::VARCHAR}, LogicalType::VARCHAR, InflectorTransformFunc,
+	                                InflectorTransformBind<InflectorTransform_Ordinalize>);
+	varchar_function.init_local_state = InflectorLocalState::InitTransform;
+	ordinalize_set.AddFunction(varchar_function);
+	ordinalize_set.AddFunction(
+	    ScalarFunction({LogicalType::BIGINT}, LogicalType::VARCHAR, InflectorOrdinalizeBigintFunc));
+	ordinalize_set.AddFunction(
+	    ScalarFunction({LogicalType::HUGEINT}, LogicalType::VARCHAR, InflectorOrdinalizeHugeintFunc));
+	CreateScalarFunctionInfo info(ordinalize_set);
+
+	for (auto &type : {LogicalType::VARCHAR, LogicalType::BIGINT, LogicalType::HUGEINT}) {
+		FunctionDescription func_desc;
+		func_desc.description = "Converts a number to its ordinal form (1st, 2nd, 3rd, etc.)";
+		func_desc.examples.push_back(type == LogicalType::VARCHAR ? "inflector_ordinalize('1')"
+		                                                          : "inflector_ordinalize(21)");
+		func_desc.parameter_names.push_back("number");
+		func_desc.parameter_types.push_back(type);
+		func_desc.categories = {"text", "inflection"};
+		info.descriptions.push_back(std::move(func_desc));
+	}
+	loader.RegisterFunction(info);
+
+	ScalarFunction deordinalize_function("inflector_deordinalize_bigint", {LogicalType::VARCHAR},
+	                                     LogicalType::BIGINT, InflectorDeordinalizeBigintFunc);
+	CreateScalarFunctionInfo deordinalize_info(deordinalize_function);
+	FunctionDescription deordinalize_desc;
+	deordinalize_desc.description =
+	    "Returns the number of an ordinal (1st -> 1) as a BIGINT, or NULL if the string is not an integer with an "
+	    "optional ordinal suffix";
+	deordinalize_desc.examples.push_back("inflector_deordinalize_bigint('21st')");
+	deordinalize_desc.parameter_names.push_back("ordinal");
+	deordinalize_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	deordinalize_desc.categories = {"text", "inflection"};
+	deordinalize_info.descriptions.push_back(std::move(deordinalize_desc));
+	loader.RegisterFunction(deordinalize_info);
+}
+
+static void InflectorDetectCaseFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<InflectorDetectCaseBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<InflectorLocalState>();
+	InflectorExecuteDetectCase(bind_data, lstate, args.data[0], result, args.size());
+}
+
+static unique_ptr<FunctionData> InflectorDetectCaseBind(ClientContext &context, ScalarFunction &bound_function,
+                                                        vector<unique_ptr<Expression>> &arguments) {
+	return InflectorDetectCaseBindData::Create(context);
+}
+
+static void InflectAllFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<InflectAllBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<InflectorLocalState>();
+	InflectorExecuteInflectAll(bind_data, lstate, args.data[0], result, args.size());
+}
+
+static unique_ptr<FunctionData> InflectAllBind(ClientContext &context, ScalarFunction &bound_function,
+                                               vector<unique_ptr<Expression>> &arguments) {
+	// The include_number flag changes the result type, so it has to be known at bind time
+	bool include_number = false;
+	if (arguments.size() == 2) {
+		auto &number_arg = arguments[1];
+		if (number_arg->HasParameter()) {
+			throw ParameterNotResolvedException();
+		}
+		if (!number_arg->IsFoldable()) {
+			throw BinderException("inflect_all: include_number argument must be constant");
+		}
+		auto number_value = ExpressionExecutor::EvaluateScalar(context, *number_arg);
+		include_number = !number_value.IsNull() && BooleanValue::Get(number_value);
+	}
+	bound_function.return_type = InflectAllType(include_number);
+	return InflectAllBindData::Create(context, include_number);
+}
+
 struct InflectBindData : public FunctionData {
 	InflectBindData() : strip_accents(false) {
 	}
@@ -102,20 +301,18 @@ struct InflectBindData : public FunctionData {
 };
 
 // Mapping from function name -> cruet transformer
-using TransformFunc = char *(*)(const char *);
-
-static const unordered_map<string, TransformFunc> transformer_map = {
-    {"camel", cruet_to_camel_case},       {"camel_case", cruet_to_camel_case},
-    {"class", cruet_to_class_case},       {"class_case", cruet_to_class_case},
-    {"pascal", cruet_to_pascal_case},     {"pascal_case", cruet_to_pascal_case},
-    {"snake", cruet_to_snake_case},       {"snake_case", cruet_to_snake_case},
-    {"kebab", cruet_to_kebab_case},       {"kebab_case", cruet_to_kebab_case},
-    {"train", cruet_to_train_case},       {"train_case", cruet_to_train_case},
-    {"title", cruet_to_title_case},       {"title_case", cruet_to_title_case},
-    {"table", cruet_to_table_case},       {"table_case", cruet_to_table_case},
-    {"sentence", cruet_to_sentence_case}, {"sentence_case", cruet_to_sentence_case},
-    {"upper", cruet_to_upper_case},       {"upper_case", cruet_to_upper_case},
-    {"lower", cruet_to_lower_case},       {"lower_case", cruet_to_lower_case}};
+static const unordered_map<string, InflectorTransform> transformer_map = {
+    {"camel", InflectorTransform_CamelCase},       {"camel_case", InflectorTransform_CamelCase},
+    {"class", InflectorTransform_ClassCase},       {"class_case", InflectorTransform_ClassCase},
+    {"pascal", InflectorTransform_PascalCase},     {"pascal_case", InflectorTransform_PascalCase},
+    {"snake", InflectorTransform_SnakeCase},       {"snake_case", InflectorTransform_SnakeCase},
+    {"kebab", InflectorTransform_KebabCase},       {"kebab_case", InflectorTransform_KebabCase},
+    {"train", InflectorTransform_TrainCase},       {"train_case", InflectorTransform_TrainCase},
+    {"title", InflectorTransform_TitleCase},       {"title_case", InflectorTransform_TitleCase},
+    {"table", InflectorTransform_TableCase},       {"table_case", InflectorTransform_TableCase},
+    {"sentence", InflectorTransform_SentenceCase}, {"sentence_case", InflectorTransform_SentenceCase},
+    {"upper", InflectorTransform_UpperCase},       {"upper_case", InflectorTransform_UpperCase},
+    {"lower", InflectorTransform_LowerCase},       {"lower_case", InflectorTransform_LowerCase}};
 
 static unique_ptr<FunctionData> InflectTableBind(ClientContext &context, TableFunctionBindInput &input,
                                                  vector<LogicalType> &return_types, vector<string> &names) {
@@ -133,7 +330,7 @@ static unique_ptr<FunctionData> InflectTableBind(ClientContext &context, TableFu
 		                            "table, sentence, upper, lower",
 		                            function_name.c_str());
 	}
-	TransformFunc transform = it->second;
+	InflectorTransform transform = it->second;
 
 	bool strip_accents = false;
 	auto sa_it = input.named_parameters.find("strip_accents");
@@ -142,23 +339,13 @@ static unique_ptr<FunctionData> InflectTableBind(ClientContext &context, TableFu
 	}
 
 	// Process each input column
+	auto acronyms = InflectorGetAcronyms(context);
 	for (idx_t i = 0; i < input.input_table_types.size(); i++) {
 		auto &part_name = input.input_table_names[i];
 		auto &part_type = input.input_table_types[i];
 
 		return_types.push_back(part_type);
-
-		std::string name_to_transform = part_name;
-		if (strip_accents) {
-			name_to_transform = StripAccentsString(name_to_transform);
-		}
-
-		char *new_name = transform(name_to_transform.c_str());
-		if (!new_name) {
-			throw InternalException("Inflector transform returned null - memory allocation failed");
-		}
-		names.emplace_back(new_name);
-		free_c_string(new_name);
+		names.emplace_back(InflectorBindCache::TransformName(transform, *acronyms, part_name, strip_accents));
 	}
 
 	auto bind_data = make_uniq<InflectBindData>();
@@ -182,24 +369,103 @@ static OperatorFinalizeResultType InflectInOutFinalize(ExecutionContext &context
 	return OperatorFinalizeResultType::FINISHED;
 }
 
-struct InflectScalarBindData : public FunctionData {
-	InflectScalarBindData(char *(*transform_func_p)(const char *), bool strip_accents_p = false)
-	    : transform_func(transform_func_p), strip_accents(strip_accents_p) {
+// Picks the reader for a file from its extension, ignoring a compression suffix
+static string InflectScanReader(const string &path) {
+	auto lower = StringUtil::Lower(path);
+	for (auto compression : {".gz", ".zst"}) {
+		if (StringUtil::EndsWith(lower, compression)) {
+			lower = lower.substr(0, lower.size() - strlen(compression));
+		}
+	}
+	if (StringUtil::EndsWith(lower, ".parquet")) {
+		return "read_parquet";
+	}
+	if (StringUtil::EndsWith(lower, ".json") || StringUtil::EndsWith(lower, ".jsonl") ||
+	    StringUtil::EndsWith(lower, ".ndjson")) {
+		return "read_json_auto";
 	}
+	return "read_csv_auto";
+}
 
-	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<InflectScalarBindData>(transform_func, strip_accents);
+// Named parameters of read_csv, read_json and read_parquet that inflect_scan passes on to the reader. They are
+// declared as ANY so that the reader casts and validates them; one the chosen reader does not know is its error.
+static const char *const INFLECT_SCAN_READER_PARAMETERS[] = {
+    // CSV
+    "all_varchar", "allow_quoted_nulls", "auto_detect", "auto_type_candidates", "columns", "comment", "dateformat",
+    "decimal_separator", "delim", "dtypes", "escape", "header", "ignore_errors", "max_line_size", "names",
+    "new_line", "normalize_names", "null_padding", "nullstr", "parallel", "quote", "rejects_limit", "sample_size",
+    "sep", "skip", "strict_mode", "timestampformat", "types",
+    // JSON
+    "convert_strings_to_integers", "field_appearance_threshold", "format", "map_inference_threshold",
+    "maximum_depth", "maximum_object_size", "maximum_sample_files", "records", "timestamp_format", "date_format",
+    // Parquet
+    "binary_as_string", "encryption_config", "file_row_number",
+    // Shared by all three
+    "compression", "filename", "hive_partitioning", "hive_types", "hive_types_autocast", "union_by_name"};
+
+static unique_ptr<ParsedExpression> InflectScanNamedParameter(const string &name, Value value) {
+	return make_uniq<ComparisonExpression>(ExpressionType::COMPARE_EQUAL, make_uniq<ColumnRefExpression>(name),
+	                                       make_uniq<ConstantExpression>(std::move(value)));
+}
+
+// inflect_scan(format, path, ...) is replaced by inflect(format, (FROM <reader>(path, ...)), strip_accents := ...)
+// before binding, with the reader options among the named parameters passed on to the reader. The optimizer turns
+// the inflect() call into a projection of the reader's columns, so filters and projections still reach the reader.
+static unique_ptr<TableRef> InflectScanBindReplace(ClientContext &context, TableFunctionBindInput &input) {
+	for (auto &value : input.inputs) {
+		if (value.IsNull()) {
+			throw InvalidInputException("inflect_scan: arguments cannot be NULL");
+		}
 	}
-	bool Equals(const FunctionData &other_p) const override {
-		auto &other = other_p.Cast<InflectScalarBindData>();
-		return transform_func == other.transform_func && strip_accents == other.strip_accents;
+	auto format = input.inputs[0].GetValue<string>();
+	auto path = input.inputs[1].GetValue<string>();
+
+	string reader = InflectScanReader(path);
+	bool strip_accents = false;
+	vector<unique_ptr<ParsedExpression>> reader_arguments;
+	reader_arguments.push_back(make_uniq<ConstantExpression>(Value(path)));
+	for (auto &param : input.named_parameters) {
+		if (param.first == "reader") {
+			if (param.second.IsNull()) {
+				throw InvalidInputException("inflect_scan: 'reader' cannot be NULL");
+			}
+			auto name = StringUtil::Lower(param.second.GetValue<string>());
+			if (name != "csv" && name != "json" && name != "parquet") {
+				throw InvalidInputException("inflect_scan: unknown reader '%s'. Supported: csv, json, parquet", name);
+			}
+			reader = name == "parquet" ? "read_parquet" : "read_" + name + "_auto";
+		} else if (param.first == "strip_accents") {
+			if (param.second.IsNull()) {
+				throw InvalidInputException("inflect_scan: 'strip_accents' cannot be NULL");
+			}
+			strip_accents = param.second.GetValue<bool>();
+		} else {
+			reader_arguments.push_back(InflectScanNamedParameter(param.first, param.second));
+		}
 	}
 
-	char *(*transform_func)(const char *);
-	bool strip_accents;
-};
+	auto reader_ref = make_uniq<TableFunctionRef>();
+	reader_ref->function = make_uniq<FunctionExpression>(reader, std::move(reader_arguments));
+	auto reader_node = make_uniq<SelectNode>();
+	reader_node->select_list.push_back(make_uniq<StarExpression>());
+	reader_node->from_table = std::move(reader_ref);
+	auto reader_select = make_uniq<SelectStatement>();
+	reader_select->node = std::move(reader_node);
+	auto reader_subquery = make_uniq<SubqueryExpression>();
+	reader_subquery->subquery_type = SubqueryType::SCALAR;
+	reader_subquery->subquery = std::move(reader_select);
+
+	vector<unique_ptr<ParsedExpression>> inflect_arguments;
+	inflect_arguments.push_back(make_uniq<ConstantExpression>(Value(format)));
+	inflect_arguments.push_back(std::move(reader_subquery));
+	inflect_arguments.push_back(InflectScanNamedParameter("strip_accents", Value::BOOLEAN(strip_accents)));
+	auto inflect_ref = make_uniq<TableFunctionRef>();
+	inflect_ref->function = make_uniq<FunctionExpression>("inflect", std::move(inflect_arguments));
+	return std::move(inflect_ref);
+}
 
-LogicalType InflectLogicalType(const LogicalType &type, TransformFunc transform, bool recursive,
+// Renames the fields of every STRUCT in a type, at any depth below lists, maps and arrays
+LogicalType InflectLogicalType(const LogicalType &type, InflectorTransform transform, const InflectorAcronyms &acronyms,
                                bool strip_accents = false) {
 	switch (type.id()) {
 
@@ -210,53 +476,26 @@ LogicalType InflectLogicalType(const LogicalType &type, TransformFunc transform,
 		new_children.reserve(children.size());
 		for (auto &child : children) {
 			auto &name = child.first;
-			auto &subtype = child.second;
-
-			LogicalType updated_type = subtype;
-			if (recursive) {
-				updated_type = InflectLogicalType(subtype, transform, false, strip_accents);
-			}
-
-			// Strip accents from the name before inflecting if requested
-			std::string name_to_transform = name;
-			if (strip_accents) {
-				name_to_transform = StripAccentsString(name_to_transform);
-			}
+			auto updated_type = InflectLogicalType(child.second, transform, acronyms, strip_accents);
 
-			// Apply name inflection here
-			auto new_name = transform(name_to_transform.c_str());
-			if (!new_name) {
-				throw InternalException("Inflector transform returned null - memory allocation failed");
-			}
-			new_children.emplace_back(new_name, updated_type);
-			free_c_string(new_name);
+			// Apply name inflection here, stripping accents first if requested
+			new_children.emplace_back(InflectorBindCache::TransformName(transform, acronyms, name, strip_accents),
+			                          updated_type);
 		}
 
 		return LogicalType::STRUCT(new_children);
 	}
 
-	case LogicalTypeId::LIST: {
-		auto &child_type = ListType::GetChildType(type);
+	case LogicalTypeId::LIST:
+		return LogicalType::LIST(InflectLogicalType(ListType::GetChildType(type), transform, acronyms, strip_accents));
 
-		// Recurse into element type if allowed
-		LogicalType elem = child_type;
-		if (recursive) {
-			elem = InflectLogicalType(child_type, transform, true, strip_accents);
-		}
-		return LogicalType::LIST(elem);
-	}
+	case LogicalTypeId::ARRAY:
+		return LogicalType::ARRAY(InflectLogicalType(ArrayType::GetChildType(type), transform, acronyms, strip_accents),
+		                          ArrayType::GetSize(type));
 
 	case LogicalTypeId::MAP: {
-		auto &key_type = MapType::KeyType(type);
-		auto &value_type = MapType::ValueType(type);
-
-		LogicalType new_key = key_type;
-		LogicalType new_value = value_type;
-
-		if (recursive) {
-			new_key = InflectLogicalType(key_type, transform, true, strip_accents);
-			new_value = InflectLogicalType(value_type, transform, true, strip_accents);
-		}
+		auto new_key = InflectLogicalType(MapType::KeyType(type), transform, acronyms, strip_accents);
+		auto new_value = InflectLogicalType(MapType::ValueType(type), transform, acronyms, strip_accents);
 		return LogicalType::MAP(new_key, new_value);
 	}
 
@@ -295,7 +534,7 @@ unique_ptr<FunctionData> InflectScalarBind(ClientContext &context, ScalarFunctio
 		                            "table, sentence, upper, lower",
 		                            function_name.c_str());
 	}
-	TransformFunc transform = it->second;
+	InflectorTransform transform = it->second;
 
 	// Check for strip_accents (3rd argument)
 	bool strip_accents = false;
@@ -310,172 +549,739 @@ unique_ptr<FunctionData> InflectScalarBind(ClientContext &context, ScalarFunctio
 		strip_accents = BooleanValue::Get(ExpressionExecutor::EvaluateScalar(context, *sa_arg));
 	}
 
+	auto bind_data = InflectorTransformBindData::Create(context, transform, strip_accents);
+
 	// We should deal with the type here now.
-	bound_function.return_type = InflectLogicalType(arguments[1]->return_type, transform, true, strip_accents);
+	auto &input_type = arguments[1]->return_type;
+	auto &acronyms = *bind_data->acronyms;
+	bound_function.return_type =
+	    InflectorBindCache::InflectType(transform, acronyms, input_type, strip_accents, [&]() {
+		    return InflectLogicalType(input_type, transform, acronyms, strip_accents);
+	    });
 
-	return make_uniq<InflectScalarBindData>(transform, strip_accents);
+	return std::move(bind_data);
 }
 
-void InflectStringFunc(DataChunk &args, ExpressionState &state, Vector &result) {
-	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
-	auto &bind_data = func_expr.bind_info->Cast<InflectScalarBindData>();
-	bool strip_accents = bind_data.strip_accents;
+// The string overloads run as the unary inflector_to_* kernel: the format and strip_accents are folded into the bind
+// data, so they are dropped from the call and only the value column is evaluated per chunk
+static unique_ptr<FunctionData> InflectStringBind(ClientContext &context, ScalarFunction &bound_function,
+                                                  vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = InflectScalarBind(context, bound_function, arguments);
+	if (arguments.size() == 3) {
+		Function::EraseArgument(bound_function, arguments, 2);
+	}
+	Function::EraseArgument(bound_function, arguments, 0);
+	return bind_data;
+}
 
-	auto &type_vector = args.data[0];
-	auto &source = args.data[1];
+// List child of a renamed LIST or MAP. The result shares the list entries of the source, which this buffer keeps
+// alive alongside the renamed child.
+class InflectListBuffer : public VectorListBuffer {
+public:
+	InflectListBuffer(const LogicalType &list_type, buffer_ptr<VectorBuffer> entries_p)
+	    : VectorListBuffer(list_type, 0), entries(std::move(entries_p)) {
+	}
 
-	BinaryExecutor::Execute<string_t, string_t, string_t>(
-	    type_vector, source, result, args.size(),
-	    [&result, strip_accents](string_t name, string_t data) -> string_t {
-		    auto function_name = name.GetString();
-		    auto value = data.GetString();
+	buffer_ptr<VectorBuffer> entries;
+};
 
-		    if (strip_accents) {
-			    value = StripAccentsString(value);
-		    }
+// Shares the validity of `source` with `result`, which already has the same vector type
+static void ReferenceValidity(Vector &source, Vector &result) {
+	if (source.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		ConstantVector::SetNull(result, ConstantVector::IsNull(source));
+	} else {
+		FlatVector::Validity(result) = FlatVector::Validity(source);
+	}
+}
 
-		    auto it = transformer_map.find(function_name);
-		    if (it == transformer_map.end()) {
-			    throw InvalidInputException(
-			        "Unknown inflection '%s'. Supported: camel, class, pascal, snake, kebab, train, title, "
-			        "table, sentence, upper, lower",
-			        function_name.c_str());
-		    }
-		    TransformFunc transform = it->second;
+// Whether a type contains a MAP with VARCHAR keys, whose keys inflect() transforms even though its type is unchanged
+static bool HasVarcharMapKeys(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::STRUCT:
+		for (auto &child : StructType::GetChildTypes(type)) {
+			if (HasVarcharMapKeys(child.second)) {
+				return true;
+			}
+		}
+		return false;
+	case LogicalTypeId::LIST:
+		return HasVarcharMapKeys(ListType::GetChildType(type));
+	case LogicalTypeId::ARRAY:
+		return HasVarcharMapKeys(ArrayType::GetChildType(type));
+	case LogicalTypeId::MAP:
+		return MapType::KeyType(type) == LogicalType::VARCHAR || HasVarcharMapKeys(MapType::KeyType(type)) ||
+		       HasVarcharMapKeys(MapType::ValueType(type));
+	default:
+		return false;
+	}
+}
 
-		    char *change_result = transform(value.c_str());
-		    if (!change_result) {
-			    throw InternalException("Inflector transform returned null - memory allocation failed");
-		    }
-		    string_t return_result = StringVector::AddString(result, change_result);
-		    free_c_string(change_result);
-		    return return_result;
-	    });
+// Makes `result` a view of `source` under its renamed type. The two types differ only in STRUCT field names, so
+// every level references the source's data, list entries and validity; nothing below the renamed fields is copied.
+// The VARCHAR keys of maps are the exception: they are data, and are replaced by their transformed form.
+static void InflectReference(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate, Vector &source,
+                             Vector &result, idx_t count) {
+	if (source.GetType() == result.GetType() && !HasVarcharMapKeys(result.GetType())) {
+		result.Reference(source);
+		return;
+	}
+	if (source.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto dictionary_size = DictionaryVector::DictionarySize(source);
+		if (!dictionary_size.IsValid()) {
+			source.Flatten(count);
+			InflectReference(bind_data, lstate, source, result, count);
+			return;
+		}
+		// Rename the dictionary once and apply the same selection to it
+		Vector dictionary(result.GetType(), 0);
+		InflectReference(bind_data, lstate, DictionaryVector::Child(source), dictionary, dictionary_size.GetIndex());
+		result.Slice(dictionary, DictionaryVector::SelVector(source), count);
+		return;
+	}
+	auto vector_type = source.GetVectorType();
+	auto row_count = vector_type == VectorType::CONSTANT_VECTOR ? 1 : count;
+
+	switch (result.GetType().InternalType()) {
+	case PhysicalType::STRUCT: {
+		auto &source_children = StructVector::GetEntries(source);
+		auto &result_children = StructVector::GetEntries(result);
+		for (idx_t i = 0; i < source_children.size(); i++) {
+			InflectReference(bind_data, lstate, *source_children[i], *result_children[i], count);
+		}
+		result.SetVectorType(vector_type);
+		break;
+	}
+	case PhysicalType::LIST: {
+		auto list_size = ListVector::GetListSize(source);
+		auto list_buffer = make_buffer<InflectListBuffer>(result.GetType(), source.GetBuffer());
+		auto &source_entry = ListVector::GetEntry(source);
+		auto &result_entry = list_buffer->GetChild();
+		if (result.GetType().id() == LogicalTypeId::MAP && MapType::KeyType(result.GetType()) == LogicalType::VARCHAR) {
+			// Flattening the entries changes how the source holds them but not their values; the transformed keys
+			// only replace the key vector of the result
+			source_entry.Flatten(list_size);
+			auto &source_children = StructVector::GetEntries(source_entry);
+			auto &result_children = StructVector::GetEntries(result_entry);
+			result_children[0]->Reference(*source_children[0]);
+			InflectorTransformMapKeys(bind_data, lstate, source, *result_children[0], row_count);
+			InflectReference(bind_data, lstate, *source_children[1], *result_children[1], list_size);
+			ReferenceValidity(source_entry, result_entry);
+		} else {
+			InflectReference(bind_data, lstate, source_entry, result_entry, list_size);
+		}
+		list_buffer->SetCapacity(list_size);
+		list_buffer->SetSize(list_size);
+
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		FlatVector::SetData(result, source.GetData());
+		result.SetAuxiliary(std::move(list_buffer));
+		result.SetVectorType(vector_type);
+		break;
+	}
+	case PhysicalType::ARRAY: {
+		auto array_buffer = make_buffer<VectorArrayBuffer>(result.GetType(), 0);
+		InflectReference(bind_data, lstate, ArrayVector::GetEntry(source), array_buffer->GetChild(),
+		                 row_count * ArrayType::GetSize(source.GetType()));
+		result.SetAuxiliary(std::move(array_buffer));
+		result.SetVectorType(vector_type);
+		break;
+	}
+	default:
+		throw InternalException("inflect: unexpected type %s", result.GetType().ToString());
+	}
+	ReferenceValidity(source, result);
+}
+
+static void InflectJsonFunc(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<InflectorTransformBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<InflectorLocalState>();
+	// Bound with InflectStringBind, so only the JSON argument is left
+	InflectorExecuteJson(bind_data, lstate, args.data[0], result, args.size());
 }
 
 void InflectScalarFunc(DataChunk &args, ExpressionState &state, Vector &result) {
-	auto &source = args.data[1];
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<InflectorTransformBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<InflectorLocalState>();
+	InflectReference(bind_data, lstate, args.data[1], result, args.size());
+	result.Verify(args.size());
+}
 
-	if (!(result.GetType().IsNested() && result.GetType().InternalType() == PhysicalType::STRUCT)) {
-		result.Reference(source);
-		result.Verify(args.size());
+struct InflectorCacheStatsState : public GlobalTableFunctionState {
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> InflectorCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("passthrough");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> InflectorCacheStatsInit(ClientContext &context,
+                                                                    TableFunctionInitInput &input) {
+	return make_uniq<InflectorCacheStatsState>();
+}
+
+static void InflectorCacheStatsFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<InflectorCacheStatsState>();
+	if (state.finished) {
 		return;
 	}
+	auto stats = InflectorCache::GetStatistics();
+	output.SetValue(0, 0, Value::UBIGINT(stats.hits));
+	output.SetValue(1, 0, Value::UBIGINT(stats.misses));
+	output.SetValue(2, 0, Value::UBIGINT(stats.evictions));
+	output.SetValue(3, 0, Value::UBIGINT(stats.passthrough));
+	output.SetCardinality(1);
+	state.finished = true;
+}
 
-	auto &source_vectors = StructVector::GetEntries(source);
-	auto &target_children = StructVector::GetEntries(result);
+struct InflectorStatsState : public GlobalTableFunctionState {
+	bool finished = false;
+};
 
-	for (idx_t i = 0; i < source_vectors.size(); i++) {
-		auto &source_vector = *source_vectors[i];
-		auto &target_vector = *target_children[i];
+// Columns of inflector_stats() and inflector_profile() after the ones identifying the function
+static void InflectorCounterColumns(vector<LogicalType> &return_types, vector<string> &names) {
+	for (auto name : {"calls", "rows", "nulls", "input_bytes", "output_bytes", "allocated_bytes", "nanos", "ffi_calls",
+	                  "ffi_nanos", "strip_accents_nanos", "errors", "cache_hits", "cache_misses", "cache_evictions",
+	                  "passthrough"}) {
+		names.emplace_back(name);
+		return_types.emplace_back(LogicalType::UBIGINT);
+	}
+}
 
-		target_vector.Reference(source_vector);
+static void InflectorSetCounters(DataChunk &output, idx_t col, idx_t row, const InflectorCounters &counters) {
+	for (auto value : {counters.calls, counters.rows, counters.nulls, counters.input_bytes, counters.output_bytes,
+	                   counters.allocated_bytes, counters.nanos, counters.ffi_calls, counters.ffi_nanos,
+	                   counters.strip_accents_nanos, counters.errors, counters.cache_hits, counters.cache_misses,
+	                   counters.cache_evictions, counters.passthrough}) {
+		output.SetValue(col++, row, Value::UBIGINT(value));
 	}
+}
 
-	if (source.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-	} else {
-		auto &result_validity = FlatVector::Validity(result);
-		result_validity = FlatVector::Validity(source);
+static unique_ptr<FunctionData> InflectorStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("function_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	InflectorCounterColumns(return_types, names);
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> InflectorStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<InflectorStatsState>();
+}
+
+// One row per function that has evaluated at least one chunk since the last reset
+static void InflectorStatsFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<InflectorStatsState>();
+	if (state.finished) {
+		return;
 	}
-	result.Verify(args.size());
+	auto stats = InflectorStatsShard::GetStatistics();
+	idx_t row = 0;
+	for (idx_t slot = 0; slot < stats.size(); slot++) {
+		auto &counters = stats[slot];
+		if (counters.calls == 0) {
+			continue;
+		}
+		output.SetValue(0, row, Value(InflectorStatsSlot::Name(slot)));
+		InflectorSetCounters(output, 1, row, counters);
+		row++;
+	}
+	output.SetCardinality(row);
+	state.finished = true;
+}
+
+static unique_ptr<FunctionData> InflectorProfileBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("expression");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("function_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	InflectorCounterColumns(return_types, names);
+	return nullptr;
+}
+
+struct InflectorProfileState : public GlobalTableFunctionState {
+	//! Taken when the scan starts, so that every chunk comes from the same profile
+	vector<InflectorExpressionCounters> expressions;
+	idx_t offset = 0;
+};
+
+static unique_ptr<GlobalTableFunctionState> InflectorProfileInit(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	auto state = make_uniq<InflectorProfileState>();
+	state->expressions = InflectorProfile::GetLastQuery(context);
+	return std::move(state);
+}
+
+// One row per inflector expression evaluated by the last profiled query
+static void InflectorProfileFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<InflectorProfileState>();
+	idx_t count = 0;
+	for (; state.offset < state.expressions.size() && count < STANDARD_VECTOR_SIZE; state.offset++, count++) {
+		auto &entry = state.expressions[state.offset];
+		output.SetValue(0, count, Value(entry.expression));
+		output.SetValue(1, count, Value(entry.function_name));
+		InflectorSetCounters(output, 2, count, entry.counters);
+	}
+	output.SetCardinality(count);
+}
+
+static unique_ptr<FunctionData> InflectorResetStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("success");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+	return nullptr;
+}
+
+static void InflectorResetStatsFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<InflectorStatsState>();
+	if (state.finished) {
+		return;
+	}
+	InflectorStatsShard::Reset();
+	output.SetValue(0, 0, Value::BOOLEAN(true));
+	output.SetCardinality(1);
+	state.finished = true;
+}
+
+static unique_ptr<FunctionData> InflectorLoadTimingsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("phase");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("nanos");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	return nullptr;
+}
+
+// One row per phase of the last LOAD, in the order they ran
+static void InflectorLoadTimingsFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<InflectorStatsState>();
+	if (state.finished) {
+		return;
+	}
+	auto phases = InflectorLoadTimings::Get();
+	idx_t row = 0;
+	for (auto &phase : phases) {
+		output.SetValue(0, row, Value(phase.first));
+		output.SetValue(1, row, Value::UBIGINT(phase.second));
+		row++;
+	}
+	output.SetCardinality(row);
+	state.finished = true;
+}
+
+// One rename planned by inflect_schema
+struct InflectSchemaRename {
+	string table_name;
+	//! Empty when the table itself is renamed
+	string column_name;
+	string new_name;
+	//! Another table or column of the same namespace ends up with the same name (compared case-insensitively)
+	bool collision;
+	//! Statements carrying out this rename, shown in the `sql` column
+	vector<string> statements;
+};
+
+struct InflectSchemaBindData : public TableFunctionData {
+	string schema_name = DEFAULT_SCHEMA;
+	InflectorTransform transform;
+	bool dry_run = true;
+	bool rename_tables = false;
+	bool strip_accents = false;
+	shared_ptr<InflectorAcronyms> acronyms;
+	//! Whether any planned rename collides, in which case nothing is applied
+	bool has_collision = false;
+	vector<InflectSchemaRename> renames;
+	//! Every statement in the order it has to be executed
+	vector<string> statements;
+};
+
+struct InflectSchemaState : public GlobalTableFunctionState {
+	idx_t offset = 0;
+	bool applied = false;
+};
+
+// Plans renaming `names`, which share one case-insensitive namespace, to `new_names`. When a new name is taken by
+// an existing name (including a change of case only), every rename of the namespace goes through a temporary name
+// first, so the statements never collide with each other halfway through.
+static void InflectSchemaPlan(InflectSchemaBindData &plan, const string &table_name, bool columns,
+                              const vector<string> &names, const vector<string> &new_names,
+                              const std::function<string(const string &, const string &)> &rename_sql) {
+	case_insensitive_map_t<idx_t> final_names;
+	case_insensitive_set_t existing_names;
+	vector<idx_t> renamed;
+	bool two_phase = false;
+	for (idx_t i = 0; i < names.size(); i++) {
+		existing_names.insert(names[i]);
+		if (names[i] != new_names[i]) {
+			renamed.push_back(i);
+		}
+	}
+	for (idx_t i = 0; i < names.size(); i++) {
+		final_names[new_names[i]]++;
+		if (names[i] != new_names[i] && existing_names.count(new_names[i])) {
+			two_phase = true;
+		}
+	}
+
+	for (auto i : renamed) {
+		InflectSchemaRename rename;
+		rename.table_name = columns ? table_name : names[i];
+		rename.column_name = columns ? names[i] : string();
+		rename.new_name = new_names[i];
+		rename.collision = final_names[new_names[i]] > 1;
+		plan.has_collision |= rename.collision;
+		if (two_phase) {
+			auto temporary_name = "__inflect_" + to_string(i);
+			while (existing_names.count(temporary_name) || final_names.count(temporary_name)) {
+				temporary_name += "_";
+			}
+			rename.statements.push_back(rename_sql(names[i], temporary_name));
+			rename.statements.push_back(rename_sql(temporary_name, new_names[i]));
+		} else {
+			rename.statements.push_back(rename_sql(names[i], new_names[i]));
+		}
+		plan.renames.push_back(std::move(rename));
+	}
+	// All renames to a temporary name have to run before the first rename to a final name
+	idx_t first = plan.renames.size() - renamed.size();
+	for (idx_t phase = 0; phase < (two_phase ? 2 : 1); phase++) {
+		for (idx_t r = first; r < plan.renames.size(); r++) {
+			plan.statements.push_back(plan.renames[r].statements[phase]);
+		}
+	}
+}
+
+// Quotes names with upper case letters too, so the rename keeps their case whatever preserve_identifier_case is
+static string InflectSchemaQuote(const string &name) {
+	return KeywordHelper::WriteOptionallyQuoted(name, '"', false);
+}
+
+// Plans the renames of the schema in `plan` as seen by the current transaction of `context`
+static void InflectSchemaPlanSchema(ClientContext &context, InflectSchemaBindData &plan) {
+	auto &schema = Catalog::GetSchema(context, INVALID_CATALOG, plan.schema_name);
+	auto qualified_schema =
+	    InflectSchemaQuote(schema.ParentCatalog().GetName()) + "." + InflectSchemaQuote(schema.name);
+
+	// Views share the namespace of tables, but only tables are renamed
+	vector<reference<TableCatalogEntry>> tables;
+	vector<string> table_names;
+	vector<string> new_table_names;
+	schema.Scan(context, CatalogType::TABLE_ENTRY, [&](CatalogEntry &entry) {
+		table_names.push_back(entry.name);
+		if (entry.type != CatalogType::TABLE_ENTRY || !plan.rename_tables) {
+			new_table_names.push_back(entry.name);
+		} else {
+			new_table_names.push_back(InflectorTransformString(InflectorTransform_TableCase, *plan.acronyms, entry.name,
+			                                                   plan.strip_accents));
+		}
+		if (entry.type == CatalogType::TABLE_ENTRY) {
+			tables.push_back(entry.Cast<TableCatalogEntry>());
+		}
+	});
+
+	// Columns are renamed first, while the tables still have their old names
+	for (auto &table_ref : tables) {
+		auto &table = table_ref.get();
+		auto qualified_table = qualified_schema + "." + InflectSchemaQuote(table.name);
+		vector<string> column_names;
+		vector<string> new_column_names;
+		for (auto &column : table.GetColumns().Logical()) {
+			column_names.push_back(column.Name());
+			new_column_names.push_back(
+			    InflectorTransformString(plan.transform, *plan.acronyms, column.Name(), plan.strip_accents));
+		}
+		InflectSchemaPlan(plan, table.name, true, column_names, new_column_names,
+		                  [&](const string &from, const string &to) {
+			                  return "ALTER TABLE " + qualified_table + " RENAME COLUMN " + InflectSchemaQuote(from) +
+			                         " TO " + InflectSchemaQuote(to);
+		                  });
+	}
+	if (plan.rename_tables) {
+		InflectSchemaPlan(plan, string(), false, table_names, new_table_names,
+		                  [&](const string &from, const string &to) {
+			                  return "ALTER TABLE " + qualified_schema + "." + InflectSchemaQuote(from) +
+			                         " RENAME TO " + InflectSchemaQuote(to);
+		                  });
+	}
+}
+
+static unique_ptr<FunctionData> InflectSchemaBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	auto &format_value = input.inputs[0];
+	if (format_value.IsNull()) {
+		throw InvalidInputException("Function name cannot be NULL");
+	}
+	auto format = format_value.GetValue<string>();
+	auto it = transformer_map.find(format);
+	if (it == transformer_map.end()) {
+		throw InvalidInputException("Unknown inflection '%s'. Supported: camel, class, pascal, snake, kebab, train, title, "
+		                            "table, sentence, upper, lower",
+		                            format.c_str());
+	}
+
+	auto bind_data = make_uniq<InflectSchemaBindData>();
+	bind_data->transform = it->second;
+	for (auto &param : input.named_parameters) {
+		if (param.second.IsNull()) {
+			throw InvalidInputException("inflect_schema: '%s' cannot be NULL", param.first);
+		}
+		if (param.first == "schema") {
+			bind_data->schema_name = param.second.GetValue<string>();
+		} else if (param.first == "dry_run") {
+			bind_data->dry_run = param.second.GetValue<bool>();
+		} else if (param.first == "rename_tables") {
+			bind_data->rename_tables = param.second.GetValue<bool>();
+		} else if (param.first == "strip_accents") {
+			bind_data->strip_accents = param.second.GetValue<bool>();
+		}
+	}
+	// The renames are committed by a connection of their own, which a ROLLBACK of the caller could not undo
+	if (!bind_data->dry_run && !context.transaction.IsAutoCommit()) {
+		throw InvalidInputException("inflect_schema: dry_run := false cannot be used inside a transaction, as the "
+		                            "renames are committed in a transaction of their own");
+	}
+	bind_data->acronyms = InflectorGetAcronyms(context);
+	InflectSchemaPlanSchema(context, *bind_data);
+
+	names.emplace_back("table_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("column_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("new_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("status");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("sql");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	return std::move(bind_data);
+}
+
+static unique_ptr<GlobalTableFunctionState> InflectSchemaInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<InflectSchemaState>();
+}
+
+static void InflectSchemaFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<InflectSchemaBindData>();
+	auto &state = data_p.global_state->Cast<InflectSchemaState>();
+	bool apply = !bind_data.dry_run && !bind_data.has_collision;
+	if (apply && !state.applied) {
+		// The renames are catalog-only changes, committed together or not at all. The plan is made again in that
+		// transaction, so that tables or columns changed by another connection since binding are not half renamed.
+		Connection connection(*context.db);
+		connection.BeginTransaction();
+		InflectSchemaBindData current;
+		current.schema_name = bind_data.schema_name;
+		current.transform = bind_data.transform;
+		current.rename_tables = bind_data.rename_tables;
+		current.strip_accents = bind_data.strip_accents;
+		current.acronyms = bind_data.acronyms;
+		try {
+			connection.context->RunFunctionInTransaction(
+			    [&]() { InflectSchemaPlanSchema(*connection.context, current); });
+		} catch (...) {
+			connection.Rollback();
+			throw;
+		}
+		if (current.statements != bind_data.statements) {
+			connection.Rollback();
+			throw InvalidInputException("inflect_schema: schema '%s' was changed by another connection while the "
+			                            "renames were planned, nothing was renamed; run inflect_schema again",
+			                            bind_data.schema_name);
+		}
+		for (auto &statement : bind_data.statements) {
+			auto result = connection.Query(statement);
+			if (result->HasError()) {
+				connection.Rollback();
+				result->ThrowError("inflect_schema: ");
+			}
+		}
+		connection.Commit();
+		state.applied = true;
+	}
+
+	idx_t count = 0;
+	for (; state.offset < bind_data.renames.size() && count < STANDARD_VECTOR_SIZE; state.offset++, count++) {
+		auto &rename = bind_data.renames[state.offset];
+		string status;
+		if (rename.collision) {
+			status = "collision";
+		} else if (bind_data.has_collision) {
+			status = "skipped";
+		} else {
+			status = apply ? "renamed" : "planned";
+		}
+		output.SetValue(0, count, Value(rename.table_name));
+		output.SetValue(1, count, rename.column_name.empty() ? Value() : Value(rename.column_name));
+		output.SetValue(2, count, Value(rename.new_name));
+		output.SetValue(3, count, Value(status));
+		output.SetValue(4, count, Value(StringUtil::Join(rename.statements, "; ")));
+	}
+	output.SetCardinality(count);
 }
 
 // Load all inflector functions
 void LoadInternal(ExtensionLoader &loader) {
+	// Time each phase so that inflector_load_timings() can show what LOAD spends its time on
+	vector<pair<string, idx_t>> load_phases;
+	auto phase_start = std::chrono::steady_clock::now();
+	auto end_phase = [&](const char *phase) {
+		auto now = std::chrono::steady_clock::now();
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - phase_start).count();
+		load_phases.emplace_back(phase, UnsafeNumericCast<idx_t>(elapsed));
+		phase_start = now;
+	};
+
 	// Transform functions - case conversion
-	RegisterInflectorTransform(loader, "inflector_to_class_case", cruet_to_class_case,
-	                           "Converts a string to ClassCase (PascalCase) format",
-	                           "inflector_to_class_case('hello_world')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_camel_case", cruet_to_camel_case,
-	                           "Converts a string to camelCase format",
-	                           "inflector_to_camel_case('hello_world')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_pascal_case", cruet_to_pascal_case,
-	                           "Converts a string to PascalCase format",
-	                           "inflector_to_pascal_case('hello_world')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_screamingsnake_case", cruet_to_screamingsnake_case,
-	                           "Converts a string to SCREAMING_SNAKE_CASE format",
-	                           "inflector_to_screamingsnake_case('helloWorld')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_snake_case", cruet_to_snake_case,
-	                           "Converts a string to snake_case format",
-	                           "inflector_to_snake_case('helloWorld')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_kebab_case", cruet_to_kebab_case,
-	                           "Converts a string to kebab-case format",
-	                           "inflector_to_kebab_case('helloWorld')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_train_case", cruet_to_train_case,
-	                           "Converts a string to Train-Case format",
-	                           "inflector_to_train_case('helloWorld')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_sentence_case", cruet_to_sentence_case,
-	                           "Converts a string to Sentence case format",
-	                           "inflector_to_sentence_case('helloWorld')", "text", {"text", "case_conversion"});
-	RegisterInflectorTransform(loader, "inflector_to_title_case", cruet_to_title_case,
-	                           "Converts a string to Title Case format",
-	                           "inflector_to_title_case('hello_world')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_ClassCase>(
+	    loader, "inflector_to_class_case", "Converts a string to ClassCase (PascalCase) format",
+	    "inflector_to_class_case('hello_world')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_CamelCase>(
+	    loader, "inflector_to_camel_case", "Converts a string to camelCase format",
+	    "inflector_to_camel_case('hello_world')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_PascalCase>(
+	    loader, "inflector_to_pascal_case", "Converts a string to PascalCase format",
+	    "inflector_to_pascal_case('hello_world')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_ScreamingSnakeCase>(
+	    loader, "inflector_to_screamingsnake_case", "Converts a string to SCREAMING_SNAKE_CASE format",
+	    "inflector_to_screamingsnake_case('helloWorld')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_SnakeCase>(
+	    loader, "inflector_to_snake_case", "Converts a string to snake_case format",
+	    "inflector_to_snake_case('helloWorld')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_KebabCase>(
+	    loader, "inflector_to_kebab_case", "Converts a string to kebab-case format",
+	    "inflector_to_kebab_case('helloWorld')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_TrainCase>(
+	    loader, "inflector_to_train_case", "Converts a string to Train-Case format",
+	    "inflector_to_train_case('helloWorld')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_SentenceCase>(
+	    loader, "inflector_to_sentence_case", "Converts a string to Sentence case format",
+	    "inflector_to_sentence_case('helloWorld')", "text", {"text", "case_conversion"});
+	RegisterInflectorTransform<InflectorTransform_TitleCase>(
+	    loader, "inflector_to_title_case", "Converts a string to Title Case format",
+	    "inflector_to_title_case('hello_world')", "text", {"text", "case_conversion"});
 
 	// Transform functions - naming conventions
-	RegisterInflectorTransform(loader, "inflector_to_table_case", cruet_to_table_case,
-	                           "Converts a string to table_cases format (snake_case plural)",
-	                           "inflector_to_table_case('FooBar')", "text", {"text", "naming"});
-	RegisterInflectorTransform(loader, "inflector_to_foreign_key", cruet_to_foreign_key,
-	                           "Converts a class name to a foreign key column name",
-	                           "inflector_to_foreign_key('Message')", "class_name", {"text", "naming"});
-	RegisterInflectorTransform(loader, "inflector_demodulize", cruet_demodulize,
-	                           "Removes the module part from a fully qualified name",
-	                           "inflector_demodulize('ActiveRecord::CoreExtensions::String')", "qualified_name", {"text", "naming"});
-	RegisterInflectorTransform(loader, "inflector_deconstantize", cruet_deconstantize,
-	                           "Removes the rightmost segment from a constant expression",
-	                           "inflector_deconstantize('Net::HTTP')", "constant", {"text", "naming"});
+	RegisterInflectorTransform<InflectorTransform_TableCase>(
+	    loader, "inflector_to_table_case", "Converts a string to table_cases format (snake_case plural)",
+	    "inflector_to_table_case('FooBar')", "text", {"text", "naming"});
+	RegisterInflectorTransform<InflectorTransform_ForeignKey>(
+	    loader, "inflector_to_foreign_key", "Converts a class name to a foreign key column name",
+	    "inflector_to_foreign_key('Message')", "class_name", {"text", "naming"});
+	RegisterInflectorTransform<InflectorTransform_Demodulize>(
+	    loader, "inflector_demodulize", "Removes the module part from a fully qualified name",
+	    "inflector_demodulize('ActiveRecord::CoreExtensions::String')", "qualified_name", {"text", "naming"});
+	RegisterInflectorTransform<InflectorTransform_Deconstantize>(
+	    loader, "inflector_deconstantize", "Removes the rightmost segment from a constant expression",
+	    "inflector_deconstantize('Net::HTTP')", "constant", {"text", "naming"});
 
 	// Transform functions - inflection
-	RegisterInflectorTransform(loader, "inflector_ordinalize", cruet_ordinalize,
-	                           "Converts a number string to its ordinal form (1st, 2nd, 3rd, etc.)",
-	                           "inflector_ordinalize('1')", "number", {"text", "inflection"});
-	RegisterInflectorTransform(loader, "inflector_deordinalize", cruet_deordinalize,
-	                           "Removes the ordinal suffix from a string (1st -> 1)",
-	                           "inflector_deordinalize('1st')", "ordinal", {"text", "inflection"});
-	RegisterInflectorTransform(loader, "inflector_to_plural", cruet_to_plural,
-	                           "Returns the plural form of a word",
-	                           "inflector_to_plural('person')", "word", {"text", "inflection"});
-	RegisterInflectorTransform(loader, "inflector_to_singular", cruet_to_singular,
-	                           "Returns the singular form of a word",
-	                           "inflector_to_singular('people')", "word", {"text", "inflection"});
+	RegisterInflectorOrdinalize(loader);
+	RegisterInflectorTransform<InflectorTransform_Deordinalize>(
+	    loader, "inflector_deordinalize", "Removes the ordinal suffix from a string (1st -> 1)",
+	    "inflector_deordinalize('1st')", "ordinal", {"text", "inflection"});
+	RegisterInflectorTransform<InflectorTransform_Plural>(
+	    loader, "inflector_to_plural", "Returns the plural form of a word", "inflector_to_plural('person')", "word",
+	    {"text", "inflection"});
+	RegisterInflectorTransform<InflectorTransform_Singular>(
+	    loader, "inflector_to_singular", "Returns the singular form of a word", "inflector_to_singular('people')",
+	    "word", {"text", "inflection"});
 
 	// Predicate functions - case detection
-	RegisterInflectorPredicate(loader, "inflector_is_class_case", cruet_is_class_case,
-	                           "Returns true if the string is in ClassCase (PascalCase) format",
-	                           "inflector_is_class_case('HelloWorld')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_camel_case", cruet_is_camel_case,
-	                           "Returns true if the string is in camelCase format",
-	                           "inflector_is_camel_case('helloWorld')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_pascal_case", cruet_is_pascal_case,
-	                           "Returns true if the string is in PascalCase format",
-	                           "inflector_is_pascal_case('HelloWorld')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_screamingsnake_case", cruet_is_screamingsnake_case,
-	                           "Returns true if the string is in SCREAMING_SNAKE_CASE format",
-	                           "inflector_is_screamingsnake_case('HELLO_WORLD')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_snake_case", cruet_is_snake_case,
-	                           "Returns true if the string is in snake_case format",
-	                           "inflector_is_snake_case('hello_world')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_kebab_case", cruet_is_kebab_case,
-	                           "Returns true if the string is in kebab-case format",
-	                           "inflector_is_kebab_case('hello-world')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_train_case", cruet_is_train_case,
-	                           "Returns true if the string is in Train-Case format",
-	                           "inflector_is_train_case('Hello-World')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_sentence_case", cruet_is_sentence_case,
-	                           "Returns true if the string is in Sentence case format",
-	                           "inflector_is_sentence_case('Hello world')", "text", {"text", "case_detection"});
-	RegisterInflectorPredicate(loader, "inflector_is_title_case", cruet_is_title_case,
-	                           "Returns true if the string is in Title Case format",
-	                           "inflector_is_title_case('Hello World')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_ClassCase>(
+	    loader, "inflector_is_class_case", "Returns true if the string is in ClassCase (PascalCase) format",
+	    "inflector_is_class_case('HelloWorld')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_CamelCase>(
+	    loader, "inflector_is_camel_case", "Returns true if the string is in camelCase format",
+	    "inflector_is_camel_case('helloWorld')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_PascalCase>(
+	    loader, "inflector_is_pascal_case", "Returns true if the string is in PascalCase format",
+	    "inflector_is_pascal_case('HelloWorld')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_ScreamingSnakeCase>(
+	    loader, "inflector_is_screamingsnake_case", "Returns true if the string is in SCREAMING_SNAKE_CASE format",
+	    "inflector_is_screamingsnake_case('HELLO_WORLD')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_SnakeCase>(
+	    loader, "inflector_is_snake_case", "Returns true if the string is in snake_case format",
+	    "inflector_is_snake_case('hello_world')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_KebabCase>(
+	    loader, "inflector_is_kebab_case", "Returns true if the string is in kebab-case format",
+	    "inflector_is_kebab_case('hello-world')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_TrainCase>(
+	    loader, "inflector_is_train_case", "Returns true if the string is in Train-Case format",
+	    "inflector_is_train_case('Hello-World')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_SentenceCase>(
+	    loader, "inflector_is_sentence_case", "Returns true if the string is in Sentence case format",
+	    "inflector_is_sentence_case('Hello world')", "text", {"text", "case_detection"});
+	RegisterInflectorPredicate<InflectorPredicate_TitleCase>(
+	    loader, "inflector_is_title_case", "Returns true if the string is in Title Case format",
+	    "inflector_is_title_case('Hello World')", "text", {"text", "case_detection"});
 
 	// Predicate functions - naming detection
-	RegisterInflectorPredicate(loader, "inflector_is_table_case", cruet_is_table_case,
-	                           "Returns true if the string is in table_case format (snake_case plural)",
-	                           "inflector_is_table_case('foo_bars')", "text", {"text", "naming"});
-	RegisterInflectorPredicate(loader, "inflector_is_foreign_key", cruet_is_foreign_key,
-	                           "Returns true if the string is in foreign key format (ends with _id)",
-	                           "inflector_is_foreign_key('message_id')", "text", {"text", "naming"});
+	RegisterInflectorPredicate<InflectorPredicate_TableCase>(
+	    loader, "inflector_is_table_case", "Returns true if the string is in table_case format (snake_case plural)",
+	    "inflector_is_table_case('foo_bars')", "text", {"text", "naming"});
+	RegisterInflectorPredicate<InflectorPredicate_ForeignKey>(
+	    loader, "inflector_is_foreign_key", "Returns true if the string is in foreign key format (ends with _id)",
+	    "inflector_is_foreign_key('message_id')", "text", {"text", "naming"});
+
+	// Case detection: every style a string is in, from a single pass
+	ScalarFunction detect_case_function("inflector_detect_case", {LogicalType::VARCHAR}, InflectorDetectCaseType(),
+	                                    InflectorDetectCaseFunc, InflectorDetectCaseBind);
+	detect_case_function.init_local_state = InflectorLocalState::Init;
+	CreateScalarFunctionInfo detect_case_info(detect_case_function);
+	FunctionDescription detect_case_desc;
+	detect_case_desc.description = "Returns a struct with one boolean per case style (snake, kebab, camel, pascal, "
+	                               "screaming_snake, train, title, sentence, table, foreign_key) that the string is in";
+	detect_case_desc.examples.push_back("inflector_detect_case('hello_world')");
+	detect_case_desc.parameter_names.push_back("text");
+	detect_case_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	detect_case_desc.categories.push_back("text");
+	detect_case_desc.categories.push_back("case_detection");
+	detect_case_info.descriptions.push_back(std::move(detect_case_desc));
+	loader.RegisterFunction(detect_case_info);
+
+	// Every case style of a string at once
+	ScalarFunctionSet inflect_all_set("inflect_all");
+	ScalarFunction inflect_all_function("inflect_all", {LogicalType::VARCHAR}, InflectAllType(false), InflectAllFunc,
+	                                    InflectAllBind);
+	inflect_all_function.init_local_state = InflectorLocalState::Init;
+	inflect_all_set.AddFunction(inflect_all_function);
+	ScalarFunction inflect_all_number_function("inflect_all", {LogicalType::VARCHAR, LogicalType::BOOLEAN},
+	                                           InflectAllType(true), InflectAllFunc, InflectAllBind);
+	inflect_all_number_function.init_local_state = InflectorLocalState::Init;
+	inflect_all_set.AddFunction(inflect_all_number_function);
+	CreateScalarFunctionInfo inflect_all_info(inflect_all_set);
+	FunctionDescription inflect_all_desc;
+	inflect_all_desc.description = "Returns a struct with the string in every case style (snake, kebab, "
+	                               "screaming_snake, camel, pascal, train, title, sentence), splitting it only once";
+	inflect_all_desc.examples.push_back("inflect_all('helloWorld')");
+	inflect_all_desc.parameter_names.push_back("text");
+	inflect_all_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	inflect_all_desc.categories.push_back("text");
+	inflect_all_desc.categories.push_back("case_conversion");
+	inflect_all_info.descriptions.push_back(std::move(inflect_all_desc));
+	FunctionDescription inflect_all_number_desc;
+	inflect_all_number_desc.description =
+	    "Returns a struct with the string in every case style, adding plural and singular when include_number is true";
+	inflect_all_number_desc.examples.push_back("inflect_all('person', true)");
+	inflect_all_number_desc.parameter_names.push_back("text");
+	inflect_all_number_desc.parameter_names.push_back("include_number");
+	inflect_all_number_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	inflect_all_number_desc.parameter_types.push_back(LogicalType::BOOLEAN);
+	inflect_all_number_desc.categories.push_back("text");
+	inflect_all_number_desc.categories.push_back("case_conversion");
+	inflect_all_info.descriptions.push_back(std::move(inflect_all_number_desc));
+	loader.RegisterFunction(inflect_all_info);
 
 	// Table function: inflect column names in query results
 	auto inflect_table_function =
@@ -496,27 +1302,148 @@ void LoadInternal(ExtensionLoader &loader) {
 	table_func_info.descriptions.push_back(std::move(table_func_desc));
 	loader.RegisterFunction(table_func_info);
 
+	// Table function: read files with inflected column names
+	TableFunction inflect_scan_function("inflect_scan", {LogicalType::VARCHAR, LogicalType::VARCHAR}, nullptr, nullptr);
+	inflect_scan_function.bind_replace = InflectScanBindReplace;
+	inflect_scan_function.named_parameters["reader"] = LogicalType::VARCHAR;
+	inflect_scan_function.named_parameters["strip_accents"] = LogicalType::BOOLEAN;
+	for (auto name : INFLECT_SCAN_READER_PARAMETERS) {
+		inflect_scan_function.named_parameters[name] = LogicalType::ANY;
+	}
+	CreateTableFunctionInfo inflect_scan_info(inflect_scan_function);
+	FunctionDescription inflect_scan_desc;
+	inflect_scan_desc.description =
+	    "Reads CSV, JSON or Parquet files (picked by extension, or with reader := 'csv'|'json'|'parquet') with their "
+	    "column names converted to the specified case format. Other named parameters (header, delim, columns, ...) "
+	    "are passed on to the reader, and filters and projections are pushed into it";
+	inflect_scan_desc.examples.push_back("FROM inflect_scan('snake', 'data/*.parquet')");
+	inflect_scan_desc.parameter_names.push_back("format");
+	inflect_scan_desc.parameter_names.push_back("path");
+	inflect_scan_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	inflect_scan_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	inflect_scan_desc.categories.push_back("text");
+	inflect_scan_desc.categories.push_back("case_conversion");
+	inflect_scan_info.descriptions.push_back(std::move(inflect_scan_desc));
+	loader.RegisterFunction(inflect_scan_info);
+
+	// Table function: rename the columns (and optionally tables) of a schema
+	TableFunction inflect_schema_function("inflect_schema", {LogicalType::VARCHAR}, InflectSchemaFunc,
+	                                      InflectSchemaBind, InflectSchemaInit);
+	inflect_schema_function.named_parameters["schema"] = LogicalType::VARCHAR;
+	inflect_schema_function.named_parameters["dry_run"] = LogicalType::BOOLEAN;
+	inflect_schema_function.named_parameters["rename_tables"] = LogicalType::BOOLEAN;
+	inflect_schema_function.named_parameters["strip_accents"] = LogicalType::BOOLEAN;
+	CreateTableFunctionInfo inflect_schema_info(inflect_schema_function);
+	FunctionDescription inflect_schema_desc;
+	inflect_schema_desc.description =
+	    "Renames every column of the tables in a schema (and the tables themselves with rename_tables := true) to the "
+	    "specified case format in a single transaction. With dry_run := true (the default) only reports the renames";
+	inflect_schema_desc.examples.push_back("CALL inflect_schema('snake', schema := 'main', dry_run := false)");
+	inflect_schema_desc.parameter_names.push_back("format");
+	inflect_schema_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	inflect_schema_desc.categories.push_back("text");
+	inflect_schema_desc.categories.push_back("case_conversion");
+	inflect_schema_info.descriptions.push_back(std::move(inflect_schema_desc));
+	loader.RegisterFunction(inflect_schema_info);
+
+	// Table function: hit rate of the per-thread transform caches
+	TableFunction cache_stats_function("inflector_cache_stats", {}, InflectorCacheStatsFunc, InflectorCacheStatsBind,
+	                                   InflectorCacheStatsInit);
+	CreateTableFunctionInfo cache_stats_info(cache_stats_function);
+	FunctionDescription cache_stats_desc;
+	cache_stats_desc.description =
+	    "Returns the hits, misses and evictions of the transform caches enabled by inflector_cache_size, "
+	    "and the number of rows returned unchanged without copying, summed over the functions of inflector_stats()";
+	cache_stats_desc.examples.push_back("FROM inflector_cache_stats()");
+	cache_stats_desc.categories.push_back("text");
+	cache_stats_info.descriptions.push_back(std::move(cache_stats_desc));
+	loader.RegisterFunction(cache_stats_info);
+
+	// Table functions: work done by each inflector function, and resetting those counters
+	TableFunction stats_function("inflector_stats", {}, InflectorStatsFunc, InflectorStatsBind, InflectorStatsInit);
+	CreateTableFunctionInfo stats_info(stats_function);
+	FunctionDescription stats_desc;
+	stats_desc.description =
+	    "Returns, for every inflector function evaluated since the last inflector_reset_stats(), the chunks and rows "
+	    "it processed, NULL rows, input and output bytes, nanoseconds spent in the Rust library and in accent "
+	    "stripping, failed chunks, cache hits, misses and evictions, and rows returned unchanged";
+	stats_desc.examples.push_back("FROM inflector_stats() ORDER BY ffi_nanos DESC");
+	stats_desc.categories.push_back("text");
+	stats_info.descriptions.push_back(std::move(stats_desc));
+	loader.RegisterFunction(stats_info);
+
+	TableFunction profile_function("inflector_profile", {}, InflectorProfileFunc, InflectorProfileBind,
+	                               InflectorProfileInit);
+	CreateTableFunctionInfo profile_info(profile_function);
+	FunctionDescription profile_desc;
+	profile_desc.description =
+	    "Returns the counters of inflector_stats() for each inflector expression of the last query that ran with the "
+	    "profiler enabled (EXPLAIN ANALYZE or PRAGMA enable_profiling), with the expression as shown in its plan";
+	profile_desc.examples.push_back("FROM inflector_profile() ORDER BY nanos DESC");
+	profile_desc.categories.push_back("text");
+	profile_info.descriptions.push_back(std::move(profile_desc));
+	loader.RegisterFunction(profile_info);
+
+	TableFunction reset_stats_function("inflector_reset_stats", {}, InflectorResetStatsFunc, InflectorResetStatsBind,
+	                                   InflectorStatsInit);
+	CreateTableFunctionInfo reset_stats_info(reset_stats_function);
+	FunctionDescription reset_stats_desc;
+	reset_stats_desc.description =
+	    "Restarts the counters reported by inflector_stats(), and so those of inflector_cache_stats(), from zero";
+	reset_stats_desc.examples.push_back("CALL inflector_reset_stats()");
+	reset_stats_desc.categories.push_back("text");
+	reset_stats_info.descriptions.push_back(std::move(reset_stats_desc));
+	loader.RegisterFunction(reset_stats_info);
+
+	TableFunction load_timings_function("inflector_load_timings", {}, InflectorLoadTimingsFunc,
+	                                    InflectorLoadTimingsBind, InflectorStatsInit);
+	CreateTableFunctionInfo load_timings_info(load_timings_function);
+	FunctionDescription load_timings_desc;
+	load_timings_desc.description =
+	    "Returns the nanoseconds the last LOAD of the extension spent registering functions, adding settings and "
+	    "starting the telemetry send, which runs in the background";
+	load_timings_desc.examples.push_back("FROM inflector_load_timings()");
+	load_timings_desc.categories.push_back("text");
+	load_timings_info.descriptions.push_back(std::move(load_timings_desc));
+	loader.RegisterFunction(load_timings_info);
+
 	// Scalar functions: inflect string values or struct field names
 	auto scalar_function_set = ScalarFunctionSet("inflect");
 	auto inflect_string_function = ScalarFunction("inflect", {LogicalType::VARCHAR, LogicalType::VARCHAR},
-	                                              LogicalType::VARCHAR, InflectStringFunc, InflectScalarBind);
+	                                              LogicalType::VARCHAR, InflectorTransformFunc, InflectStringBind);
+	inflect_string_function.init_local_state = InflectorLocalState::InitTransform;
 	scalar_function_set.AddFunction(inflect_string_function);
 
 	auto inflect_struct_function = ScalarFunction("inflect", {LogicalType::VARCHAR, LogicalType::ANY}, LogicalType::ANY,
 	                                              InflectScalarFunc, InflectScalarBind);
+	inflect_struct_function.init_local_state = InflectorLocalState::InitTransform;
 	scalar_function_set.AddFunction(inflect_struct_function);
 
 	// 3-argument overloads with strip_accents boolean
 	auto inflect_string_sa_function =
 	    ScalarFunction("inflect", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::BOOLEAN},
-	                   LogicalType::VARCHAR, InflectStringFunc, InflectScalarBind);
+	                   LogicalType::VARCHAR, InflectorTransformFunc, InflectStringBind);
+	inflect_string_sa_function.init_local_state = InflectorLocalState::InitTransform;
 	scalar_function_set.AddFunction(inflect_string_sa_function);
 
 	auto inflect_struct_sa_function =
 	    ScalarFunction("inflect", {LogicalType::VARCHAR, LogicalType::ANY, LogicalType::BOOLEAN}, LogicalType::ANY,
 	                   InflectScalarFunc, InflectScalarBind);
+	inflect_struct_sa_function.init_local_state = InflectorLocalState::InitTransform;
 	scalar_function_set.AddFunction(inflect_struct_sa_function);
 
+	// JSON overloads: rewrite the object keys in the JSON text
+	auto inflect_json_function = ScalarFunction("inflect", {LogicalType::VARCHAR, LogicalType::JSON()},
+	                                            LogicalType::JSON(), InflectJsonFunc, InflectStringBind);
+	inflect_json_function.init_local_state = InflectorLocalState::InitTransform;
+	scalar_function_set.AddFunction(inflect_json_function);
+
+	auto inflect_json_sa_function =
+	    ScalarFunction("inflect", {LogicalType::VARCHAR, LogicalType::JSON(), LogicalType::BOOLEAN},
+	                   LogicalType::JSON(), InflectJsonFunc, InflectStringBind);
+	inflect_json_sa_function.init_local_state = InflectorLocalState::InitTransform;
+	scalar_function_set.AddFunction(inflect_json_sa_function);
+
 	CreateScalarFunctionInfo scalar_func_info(scalar_function_set);
 
 	// Description for string variant
@@ -543,32 +1470,68 @@ void LoadInternal(ExtensionLoader &loader) {
 	struct_func_desc.categories.push_back("case_conversion");
 	scalar_func_info.descriptions.push_back(std::move(struct_func_desc));
 
+	// Description for JSON variant
+	FunctionDescription json_func_desc;
+	json_func_desc.description = "Transforms the object keys of a JSON value at every depth using the specified case "
+	                             "format, leaving the values unchanged";
+	json_func_desc.examples.push_back("inflect('snake', '{\"firstName\": \"John\"}'::JSON)");
+	json_func_desc.parameter_names.push_back("format");
+	json_func_desc.parameter_names.push_back("json");
+	json_func_desc.parameter_types.push_back(LogicalType::VARCHAR);
+	json_func_desc.parameter_types.push_back(LogicalType::JSON());
+	json_func_desc.categories.push_back("json");
+	json_func_desc.categories.push_back("case_conversion");
+	scalar_func_info.descriptions.push_back(std::move(json_func_desc));
+
 	loader.RegisterFunction(scalar_func_info);
+	end_phase("functions");
 
 	// --- Acronym configuration via DuckDB setting ---
 	auto &db = loader.GetDatabaseInstance();
 	auto &config = DBConfig::GetConfig(db);
-	config.AddExtensionOption(
-	    "inflector_acronyms",
-	    "List of acronyms preserved as uppercase in case conversions (e.g., HTML, API)",
-	    LogicalType::LIST(LogicalType::VARCHAR), Value::LIST(LogicalType::VARCHAR, vector<Value>()),
-	    [](ClientContext &context, SetScope scope, Value &parameter) {
-		    if (parameter.IsNull() || ListValue::GetChildren(parameter).empty()) {
-			    cruet_clear_acronyms();
-			    return;
-		    }
-		    auto &children = ListValue::GetChildren(parameter);
-		    string csv;
-		    for (idx_t i = 0; i < children.size(); i++) {
-			    if (i > 0) {
-				    csv += ",";
-			    }
-			    csv += children[i].GetValue<string>();
-		    }
-		    cruet_set_acronyms(csv.c_str());
-	    });
-
+	// Read from the client context when a function is bound, so SET SESSION only affects its own connection and
+	// running queries keep the acronyms they were planned with
+	config.AddExtensionOption("inflector_acronyms",
+	                          "List of acronyms preserved as uppercase in case conversions (e.g., HTML, API)",
+	                          LogicalType::LIST(LogicalType::VARCHAR),
+	                          Value::LIST(LogicalType::VARCHAR, vector<Value>()));
+
+	// Plural rules on top of the built-in ones, compiled once per bound function like the acronyms
+	config.AddExtensionOption("inflector_irregulars",
+	                          "Irregular plurals used by inflector_to_plural, inflector_to_singular and table case, "
+	                          "as a map from singular to plural (e.g., MAP {'datum': 'data'})",
+	                          LogicalType::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR),
+	                          Value::MAP(LogicalType::VARCHAR, LogicalType::VARCHAR, vector<Value>(),
+	                                     vector<Value>()));
+	config.AddExtensionOption("inflector_uncountables",
+	                          "Words that inflector_to_plural, inflector_to_singular and table case leave unchanged "
+	                          "(e.g., metadata)",
+	                          LogicalType::LIST(LogicalType::VARCHAR),
+	                          Value::LIST(LogicalType::VARCHAR, vector<Value>()));
+
+	// --- C++ fast path for ASCII-only values ---
+	config.AddExtensionOption("inflector_ascii_fast_path",
+	                          "Convert ASCII-only values to snake, kebab, camel, pascal, screaming snake, train, title "
+	                          "and sentence case in C++ instead of calling into Rust",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
+	// --- Per-thread memoization of transform results ---
+	config.AddExtensionOption("inflector_cache_size",
+	                          "Maximum number of transform results each thread memoizes for repeated values (0 to "
+	                          "disable); see inflector_cache_stats()",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+
+	// --- Plan inflect(format, subquery) as a projection so the optimizer can see through it ---
+	OptimizerExtension inflect_optimizer;
+	inflect_optimizer.pre_optimize_function = InflectorPreOptimize;
+	config.optimizer_extensions.push_back(std::move(inflect_optimizer));
+	end_phase("settings");
+
+	// Only hands the data to a background thread; the request itself never blocks LOAD
 	QueryFarmSendTelemetry(loader, "inflector", "2025110901");
+	end_phase("telemetry");
+
+	InflectorLoadTimings::Set(std::move(load_phases));
 }
 
 void InflectorExtension::Load(ExtensionLoader &loader) {
@@ -0,0 +1,55 @@
+#include "inflector_optimizer.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+static bool IsInflectTableFunction(LogicalOperator &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_GET || op.children.size() != 1) {
+		return false;
+	}
+	auto &get = op.Cast<LogicalGet>();
+	// Input columns projected alongside the output (lateral calls) are left to the in-out function
+	return get.function.name == "inflect" && get.function.in_out_function && get.projected_input.empty();
+}
+
+// Output column i of inflect() is input column i under a new name, so the projection keeps the table index of the
+// get and maps every column it reads to the matching binding of the subquery
+static unique_ptr<LogicalOperator> InflectToProjection(unique_ptr<LogicalOperator> op) {
+	auto &get = op->Cast<LogicalGet>();
+	auto child = std::move(get.children[0]);
+	child->ResolveOperatorTypes();
+	auto child_bindings = child->GetColumnBindings();
+
+	vector<unique_ptr<Expression>> expressions;
+	for (auto &column_id : get.GetColumnIds()) {
+		auto column_index = column_id.GetPrimaryIndex();
+		if (column_index >= child_bindings.size()) {
+			// The row id, only read when no column is (e.g. count(*)); any value will do
+			expressions.push_back(make_uniq<BoundConstantExpression>(Value::BIGINT(0)));
+			continue;
+		}
+		expressions.push_back(make_uniq<BoundColumnRefExpression>(
+		    get.names[column_index], get.returned_types[column_index], child_bindings[column_index]));
+	}
+	auto projection = make_uniq<LogicalProjection>(get.table_index, std::move(expressions));
+	projection->children.push_back(std::move(child));
+	return std::move(projection);
+}
+
+static void RewriteInflect(unique_ptr<LogicalOperator> &op) {
+	for (auto &child : op->children) {
+		RewriteInflect(child);
+	}
+	if (IsInflectTableFunction(*op)) {
+		op = InflectToProjection(std::move(op));
+	}
+}
+
+void InflectorPreOptimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	RewriteInflect(plan);
+}
+
+} // namespace duckdb
@@ -0,0 +1,224 @@
+#include "inflector_stats.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
+
+#include <unordered_set>
+
+namespace duckdb {
+
+void InflectorCounters::Add(const InflectorCounters &other) {
+	calls += other.calls;
+	rows += other.rows;
+	nulls += other.nulls;
+	input_bytes += other.input_bytes;
+	output_bytes += other.output_bytes;
+	allocated_bytes += other.allocated_bytes;
+	nanos += other.nanos;
+	ffi_calls += other.ffi_calls;
+	ffi_nanos += other.ffi_nanos;
+	strip_accents_nanos += other.strip_accents_nanos;
+	errors += other.errors;
+	cache_hits += other.cache_hits;
+	cache_misses += other.cache_misses;
+	cache_evictions += other.cache_evictions;
+	passthrough += other.passthrough;
+}
+
+void InflectorCounters::Subtract(const InflectorCounters &other) {
+	calls -= other.calls;
+	rows -= other.rows;
+	nulls -= other.nulls;
+	input_bytes -= other.input_bytes;
+	output_bytes -= other.output_bytes;
+	allocated_bytes -= other.allocated_bytes;
+	nanos -= other.nanos;
+	ffi_calls -= other.ffi_calls;
+	ffi_nanos -= other.ffi_nanos;
+	strip_accents_nanos -= other.strip_accents_nanos;
+	errors -= other.errors;
+	cache_hits -= other.cache_hits;
+	cache_misses -= other.cache_misses;
+	cache_evictions -= other.cache_evictions;
+	passthrough -= other.passthrough;
+}
+
+// Indexed by InflectorTransform, then InflectorPredicate, then the two slots that are neither
+static const char *const SLOT_NAMES[] = {"inflector_to_class_case",
+                                         "inflector_to_camel_case",
+                                         "inflector_to_pascal_case",
+                                         "inflector_to_screamingsnake_case",
+                                         "inflector_to_snake_case",
+                                         "inflector_to_kebab_case",
+                                         "inflector_to_train_case",
+                                         "inflector_to_sentence_case",
+                                         "inflector_to_title_case",
+                                         "inflector_to_upper_case",
+                                         "inflector_to_lower_case",
+                                         "inflector_to_table_case",
+                                         "inflector_ordinalize",
+                                         "inflector_deordinalize",
+                                         "inflector_to_foreign_key",
+                                         "inflector_demodulize",
+                                         "inflector_deconstantize",
+                                         "inflector_to_plural",
+                                         "inflector_to_singular",
+                                         "inflector_is_class_case",
+                                         "inflector_is_camel_case",
+                                         "inflector_is_pascal_case",
+                                         "inflector_is_screamingsnake_case",
+                                         "inflector_is_snake_case",
+                                         "inflector_is_kebab_case",
+                                         "inflector_is_train_case",
+                                         "inflector_is_sentence_case",
+                                         "inflector_is_title_case",
+                                         "inflector_is_table_case",
+                                         "inflector_is_foreign_key",
+                                         "inflector_detect_case",
+                                         "inflect_all"};
+static constexpr idx_t TRANSFORM_SLOTS = InflectorTransform_Singular + 1;
+static constexpr idx_t PREDICATE_SLOTS = InflectorPredicate_ForeignKey + 1;
+static_assert(sizeof(SLOT_NAMES) / sizeof(SLOT_NAMES[0]) == InflectorStatsSlot::COUNT, "one name per slot");
+static_assert(TRANSFORM_SLOTS + PREDICATE_SLOTS + 2 == InflectorStatsSlot::COUNT, "one slot per function");
+
+idx_t InflectorStatsSlot::Transform(InflectorTransform transform) {
+	return static_cast<idx_t>(transform);
+}
+
+idx_t InflectorStatsSlot::Predicate(InflectorPredicate predicate) {
+	return TRANSFORM_SLOTS + static_cast<idx_t>(predicate);
+}
+
+idx_t InflectorStatsSlot::DetectCase() {
+	return TRANSFORM_SLOTS + PREDICATE_SLOTS;
+}
+
+idx_t InflectorStatsSlot::InflectAll() {
+	return TRANSFORM_SLOTS + PREDICATE_SLOTS + 1;
+}
+
+const char *InflectorStatsSlot::Name(idx_t slot) {
+	D_ASSERT(slot < COUNT);
+	return SLOT_NAMES[slot];
+}
+
+struct InflectorStatsRegistry {
+	mutex lock;
+	std::unordered_set<InflectorStatsShard *> shards;
+	//! Counts of shards that no longer exist
+	InflectorCounters retired[InflectorStatsSlot::COUNT];
+	//! Totals at the last reset, subtracted when reading
+	InflectorCounters baseline[InflectorStatsSlot::COUNT];
+};
+
+// Never destroyed, so execution states that outlive static destruction can still retire their shards
+static InflectorStatsRegistry &GetRegistry() {
+	static auto registry = new InflectorStatsRegistry();
+	return *registry;
+}
+
+vector<InflectorCounters> InflectorStatsShard::GetTotals(InflectorStatsRegistry &registry) {
+	vector<InflectorCounters> totals(registry.retired, registry.retired + InflectorStatsSlot::COUNT);
+	for (auto shard : registry.shards) {
+		lock_guard<mutex> guard(shard->lock);
+		totals[shard->slot].Add(shard->counters);
+	}
+	return totals;
+}
+
+InflectorStatsShard::InflectorStatsShard(idx_t slot_p) : slot(slot_p) {
+	auto &registry = GetRegistry();
+	lock_guard<mutex> guard(registry.lock);
+	registry.shards.insert(this);
+}
+
+InflectorStatsShard::~InflectorStatsShard() {
+	auto &registry = GetRegistry();
+	lock_guard<mutex> guard(registry.lock);
+	registry.shards.erase(this);
+	registry.retired[slot].Add(counters);
+}
+
+void InflectorStatsShard::Add(const InflectorCounters &chunk) {
+	lock_guard<mutex> guard(lock);
+	counters.Add(chunk);
+}
+
+vector<InflectorCounters> InflectorStatsShard::GetStatistics() {
+	auto &registry = GetRegistry();
+	lock_guard<mutex> guard(registry.lock);
+	auto totals = GetTotals(registry);
+	for (idx_t slot = 0; slot < InflectorStatsSlot::COUNT; slot++) {
+		totals[slot].Subtract(registry.baseline[slot]);
+	}
+	return totals;
+}
+
+static constexpr const char *PROFILE_STATE_KEY = "inflector_profile";
+
+shared_ptr<InflectorProfileEntry> InflectorProfile::Register(ClientContext &context,
+                                                             const BoundFunctionExpression &expr) {
+	if (!QueryProfiler::Get(context).IsEnabled()) {
+		return nullptr;
+	}
+	auto profile = context.registered_state->GetOrCreate<InflectorProfile>(PROFILE_STATE_KEY);
+	lock_guard<mutex> guard(profile->lock);
+	// Every thread evaluating the expression has its own execution state, but they share one entry. Expressions are
+	// told apart by identity, so that two that print the same (e.g. in both sides of a UNION) are counted separately.
+	for (auto &entry : profile->current_query) {
+		if (entry->expr == &expr) {
+			return entry;
+		}
+	}
+	auto entry = make_shared_ptr<InflectorProfileEntry>();
+	entry->expr = &expr;
+	entry->data.expression = expr.ToString();
+	entry->data.function_name = expr.function.name;
+	profile->current_query.push_back(entry);
+	return entry;
+}
+
+vector<InflectorExpressionCounters> InflectorProfile::GetLastQuery(ClientContext &context) {
+	vector<InflectorExpressionCounters> result;
+	auto profile = context.registered_state->Get<InflectorProfile>(PROFILE_STATE_KEY);
+	if (!profile) {
+		return result;
+	}
+	lock_guard<mutex> guard(profile->lock);
+	for (auto &entry : profile->last_query) {
+		lock_guard<mutex> entry_guard(entry->lock);
+		result.push_back(entry->data);
+	}
+	return result;
+}
+
+void InflectorProfile::QueryEnd(ClientContext &context) {
+	lock_guard<mutex> guard(lock);
+	// Queries without inflector functions, such as the one reading inflector_profile(), keep the last profile
+	if (!current_query.empty()) {
+		last_query = std::move(current_query);
+		current_query.clear();
+	}
+}
+
+void InflectorStatsShard::Reset() {
+	auto &registry = GetRegistry();
+	lock_guard<mutex> guard(registry.lock);
+	// Shards keep counting from where they are, so a reset only moves the baseline
+	auto totals = GetTotals(registry);
+	std::copy(totals.begin(), totals.end(), registry.baseline);
+}
+
+static mutex load_timings_lock;
+static vector<pair<string, idx_t>> load_timings;
+
+void InflectorLoadTimings::Set(vector<pair<string, idx_t>> phases) {
+	lock_guard<mutex> guard(load_timings_lock);
+	load_timings = std::move(phases);
+}
+
+vector<pair<string, idx_t>> InflectorLoadTimings::Get() {
+	lock_guard<mutex> guard(load_timings_lock);
+	return load_timings;
+}
+
+} // namespace duckdb
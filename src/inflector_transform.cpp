@@ -0,0 +1,1559 @@
+#include "inflector_transform.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "utf8proc.hpp"
+#include "yyjson.hpp"
+
+#include <mutex>
+
+namespace duckdb {
+
+// Compares an ASCII word, uppercased on the fly, against an uppercased acronym
+static int CompareAcronym(const char *word, idx_t len, const string &acronym) {
+	auto common = MinValue<idx_t>(len, acronym.size());
+	for (idx_t i = 0; i < common; i++) {
+		auto lhs = static_cast<unsigned char>(inflector_ascii::ToUpper(word[i]));
+		auto rhs = static_cast<unsigned char>(acronym[i]);
+		if (lhs != rhs) {
+			return lhs < rhs ? -1 : 1;
+		}
+	}
+	if (len == acronym.size()) {
+		return 0;
+	}
+	return len < acronym.size() ? -1 : 1;
+}
+
+InflectorAcronyms::InflectorAcronyms() : fingerprint(0), table {nullptr, 0, nullptr} {
+}
+
+InflectorAcronyms::InflectorAcronyms(vector<string> words_p, vector<pair<string, string>> irregulars_p,
+                                     vector<string> uncountables_p)
+    : words(std::move(words_p)), irregulars(std::move(irregulars_p)), uncountables(std::move(uncountables_p)),
+      fingerprint(0) {
+	std::sort(words.begin(), words.end());
+	words.erase(std::unique(words.begin(), words.end()), words.end());
+	entries.reserve(words.size());
+	for (auto &word : words) {
+		entries.push_back({word.c_str(), UnsafeNumericCast<uintptr_t>(word.size())});
+		fingerprint = CombineHash(fingerprint, Hash(word.c_str(), word.size()));
+	}
+
+	if (!irregulars.empty() || !uncountables.empty()) {
+		vector<InflectorString> rule_entries;
+		for (auto &irregular : irregulars) {
+			rule_entries.push_back({irregular.first.c_str(), UnsafeNumericCast<uintptr_t>(irregular.first.size())});
+			rule_entries.push_back({irregular.second.c_str(), UnsafeNumericCast<uintptr_t>(irregular.second.size())});
+		}
+		for (auto &word : uncountables) {
+			rule_entries.push_back({word.c_str(), UnsafeNumericCast<uintptr_t>(word.size())});
+		}
+		for (auto &entry : rule_entries) {
+			fingerprint = CombineHash(fingerprint, Hash(entry.data, entry.len));
+		}
+		// The counts tell apart rule sets that list the same strings in different roles
+		fingerprint = CombineHash(fingerprint, CombineHash(Hash(irregulars.size()), Hash(uncountables.size())));
+		plural_rules.reset(cruet_compile_plural_rules(rule_entries.data(), irregulars.size(),
+		                                              rule_entries.data() + irregulars.size() * 2,
+		                                              uncountables.size()));
+	}
+	table = {entries.data(), UnsafeNumericCast<uintptr_t>(entries.size()), plural_rules.get()};
+}
+
+bool InflectorAcronyms::ContainsAscii(const char *word, idx_t len) const {
+	if (len < 2 || words.empty()) {
+		return false;
+	}
+	idx_t lower = 0;
+	idx_t upper = words.size();
+	while (lower < upper) {
+		auto middle = lower + (upper - lower) / 2;
+		auto cmp = CompareAcronym(word, len, words[middle]);
+		if (cmp == 0) {
+			return true;
+		}
+		if (cmp < 0) {
+			upper = middle;
+		} else {
+			lower = middle + 1;
+		}
+	}
+	return false;
+}
+
+shared_ptr<InflectorAcronyms> InflectorGetAcronyms(ClientContext &context) {
+	vector<string> words;
+	Value setting;
+	if (context.TryGetCurrentSetting("inflector_acronyms", setting) && !setting.IsNull()) {
+		InflectorAcronyms none;
+		for (auto &child : ListValue::GetChildren(setting)) {
+			if (child.IsNull()) {
+				continue;
+			}
+			auto word = child.GetValue<string>();
+			StringUtil::Trim(word);
+			// Uppercase in Rust so that non-ASCII acronyms are matched the same way as the words they are compared to
+			word = InflectorTransformString(InflectorTransform_UpperCase, none, word);
+			// Single-character acronyms are ignored
+			if (word.size() >= 2) {
+				words.push_back(std::move(word));
+			}
+		}
+	}
+
+	vector<pair<string, string>> irregulars;
+	if (context.TryGetCurrentSetting("inflector_irregulars", setting) && !setting.IsNull()) {
+		for (auto &entry : MapValue::GetChildren(setting)) {
+			auto &key_value = StructValue::GetChildren(entry);
+			if (!key_value[0].IsNull() && !key_value[1].IsNull()) {
+				irregulars.emplace_back(key_value[0].GetValue<string>(), key_value[1].GetValue<string>());
+			}
+		}
+	}
+	vector<string> uncountables;
+	if (context.TryGetCurrentSetting("inflector_uncountables", setting) && !setting.IsNull()) {
+		for (auto &child : ListValue::GetChildren(setting)) {
+			if (!child.IsNull()) {
+				uncountables.push_back(child.GetValue<string>());
+			}
+		}
+	}
+	return make_shared_ptr<InflectorAcronyms>(std::move(words), std::move(irregulars), std::move(uncountables));
+}
+
+// The ASCII kernels and classifiers are used unless `inflector_ascii_fast_path` is disabled
+static bool UseAsciiFastPath(ClientContext &context) {
+	Value fast_path;
+	return !context.TryGetCurrentSetting("inflector_ascii_fast_path", fast_path) || fast_path.IsNull() ||
+	       BooleanValue::Get(fast_path);
+}
+
+InflectorTransformBindData::InflectorTransformBindData(InflectorTransform transform_func_p, bool strip_accents_p)
+    : transform_func(transform_func_p), strip_accents(strip_accents_p), ascii_kernel(nullptr),
+      acronyms(make_shared_ptr<InflectorAcronyms>()), cache_size(0) {
+}
+
+unique_ptr<InflectorTransformBindData> InflectorTransformBindData::Create(ClientContext &context,
+                                                                          InflectorTransform transform_func,
+                                                                          bool strip_accents) {
+	auto bind_data = make_uniq<InflectorTransformBindData>(transform_func, strip_accents);
+
+	if (UseAsciiFastPath(context)) {
+		bind_data->ascii_kernel = InflectorGetAsciiKernel(transform_func);
+	}
+	bind_data->acronyms = InflectorGetAcronyms(context);
+
+	Value cache_size;
+	if (context.TryGetCurrentSetting("inflector_cache_size", cache_size) && !cache_size.IsNull()) {
+		bind_data->cache_size = UBigIntValue::Get(cache_size);
+	}
+	return bind_data;
+}
+
+string InflectorTransformBindData::Transform(const string &input) const {
+	if (ascii_kernel && inflector_ascii::IsAscii(input.data(), input.size())) {
+		string output(input.size() * 2, '\0');
+		bool unchanged;
+		output.resize(ascii_kernel(input.data(), input.size(), &output[0], *acronyms, unchanged));
+		return output;
+	}
+	return InflectorTransformString(transform_func, *acronyms, input, strip_accents);
+}
+
+unique_ptr<FunctionData> InflectorTransformBindData::Copy() const {
+	auto copy = make_uniq<InflectorTransformBindData>(transform_func, strip_accents);
+	copy->ascii_kernel = ascii_kernel;
+	copy->acronyms = acronyms;
+	copy->cache_size = cache_size;
+	return std::move(copy);
+}
+
+bool InflectorTransformBindData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<InflectorTransformBindData>();
+	return transform_func == other.transform_func && strip_accents == other.strip_accents &&
+	       ascii_kernel == other.ascii_kernel && acronyms->Equals(*other.acronyms) && cache_size == other.cache_size;
+}
+
+InflectorPredicateBindData::InflectorPredicateBindData(InflectorPredicate predicate_p)
+    : predicate(predicate_p), ascii_predicate(nullptr), acronyms(make_shared_ptr<InflectorAcronyms>()) {
+}
+
+unique_ptr<InflectorPredicateBindData> InflectorPredicateBindData::Create(ClientContext &context,
+                                                                          InflectorPredicate predicate) {
+	auto bind_data = make_uniq<InflectorPredicateBindData>(predicate);
+	if (UseAsciiFastPath(context)) {
+		bind_data->ascii_predicate = InflectorGetAsciiPredicate(predicate);
+	}
+	bind_data->acronyms = InflectorGetAcronyms(context);
+	return bind_data;
+}
+
+unique_ptr<FunctionData> InflectorPredicateBindData::Copy() const {
+	auto copy = make_uniq<InflectorPredicateBindData>(predicate);
+	copy->ascii_predicate = ascii_predicate;
+	copy->acronyms = acronyms;
+	return std::move(copy);
+}
+
+bool InflectorPredicateBindData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<InflectorPredicateBindData>();
+	return predicate == other.predicate && ascii_predicate == other.ascii_predicate &&
+	       acronyms->Equals(*other.acronyms);
+}
+
+InflectorDetectCaseBindData::InflectorDetectCaseBindData(bool ascii_fast_path_p,
+                                                         shared_ptr<InflectorAcronyms> acronyms_p)
+    : ascii_fast_path(ascii_fast_path_p), acronyms(std::move(acronyms_p)) {
+}
+
+unique_ptr<InflectorDetectCaseBindData> InflectorDetectCaseBindData::Create(ClientContext &context) {
+	return make_uniq<InflectorDetectCaseBindData>(UseAsciiFastPath(context), InflectorGetAcronyms(context));
+}
+
+unique_ptr<FunctionData> InflectorDetectCaseBindData::Copy() const {
+	return make_uniq<InflectorDetectCaseBindData>(ascii_fast_path, acronyms);
+}
+
+bool InflectorDetectCaseBindData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<InflectorDetectCaseBindData>();
+	return ascii_fast_path == other.ascii_fast_path && acronyms->Equals(*other.acronyms);
+}
+
+InflectAllBindData::InflectAllBindData(vector<InflectorTransform> transforms_p, bool ascii_fast_path_p,
+                                       shared_ptr<InflectorAcronyms> acronyms_p)
+    : transforms(std::move(transforms_p)), ascii_fast_path(ascii_fast_path_p), acronyms(std::move(acronyms_p)) {
+}
+
+unique_ptr<FunctionData> InflectAllBindData::Copy() const {
+	return make_uniq<InflectAllBindData>(transforms, ascii_fast_path, acronyms);
+}
+
+bool InflectAllBindData::Equals(const FunctionData &other_p) const {
+	auto &other = other_p.Cast<InflectAllBindData>();
+	return transforms == other.transforms && ascii_fast_path == other.ascii_fast_path &&
+	       acronyms->Equals(*other.acronyms);
+}
+
+inflector_ascii_kernel_t InflectorGetAsciiKernel(InflectorTransform transform) {
+	switch (transform) {
+	case InflectorTransform_SnakeCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::SnakeCase>;
+	case InflectorTransform_KebabCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::KebabCase>;
+	case InflectorTransform_ScreamingSnakeCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::ScreamingSnakeCase>;
+	case InflectorTransform_CamelCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::CamelCase>;
+	case InflectorTransform_ClassCase:
+	case InflectorTransform_PascalCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::PascalCase>;
+	case InflectorTransform_TrainCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::TrainCase>;
+	case InflectorTransform_TitleCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::TitleCase>;
+	case InflectorTransform_SentenceCase:
+		return inflector_ascii::ConvertCase<inflector_ascii::SentenceCase>;
+	default:
+		return nullptr;
+	}
+}
+
+inflector_ascii_renderer_t InflectorGetAsciiRenderer(InflectorTransform transform) {
+	switch (transform) {
+	case InflectorTransform_SnakeCase:
+		return inflector_ascii::RenderWords<inflector_ascii::SnakeCase>;
+	case InflectorTransform_KebabCase:
+		return inflector_ascii::RenderWords<inflector_ascii::KebabCase>;
+	case InflectorTransform_ScreamingSnakeCase:
+		return inflector_ascii::RenderWords<inflector_ascii::ScreamingSnakeCase>;
+	case InflectorTransform_CamelCase:
+		return inflector_ascii::RenderWords<inflector_ascii::CamelCase>;
+	case InflectorTransform_ClassCase:
+	case InflectorTransform_PascalCase:
+		return inflector_ascii::RenderWords<inflector_ascii::PascalCase>;
+	case InflectorTransform_TrainCase:
+		return inflector_ascii::RenderWords<inflector_ascii::TrainCase>;
+	case InflectorTransform_TitleCase:
+		return inflector_ascii::RenderWords<inflector_ascii::TitleCase>;
+	case InflectorTransform_SentenceCase:
+		return inflector_ascii::RenderWords<inflector_ascii::SentenceCase>;
+	default:
+		return nullptr;
+	}
+}
+
+inflector_ascii_predicate_t InflectorGetAsciiPredicate(InflectorPredicate predicate) {
+	switch (predicate) {
+	case InflectorPredicate_SnakeCase:
+		return inflector_ascii::IsCase<inflector_ascii::SnakeCase>;
+	case InflectorPredicate_KebabCase:
+		return inflector_ascii::IsCase<inflector_ascii::KebabCase>;
+	case InflectorPredicate_ScreamingSnakeCase:
+		return inflector_ascii::IsCase<inflector_ascii::ScreamingSnakeCase>;
+	case InflectorPredicate_CamelCase:
+		return inflector_ascii::IsCase<inflector_ascii::CamelCase>;
+	case InflectorPredicate_ClassCase:
+	case InflectorPredicate_PascalCase:
+		return inflector_ascii::IsCase<inflector_ascii::PascalCase>;
+	case InflectorPredicate_TrainCase:
+		return inflector_ascii::IsCase<inflector_ascii::TrainCase>;
+	case InflectorPredicate_TitleCase:
+		return inflector_ascii::IsCase<inflector_ascii::TitleCase>;
+	case InflectorPredicate_SentenceCase:
+		return inflector_ascii::IsCase<inflector_ascii::SentenceCase>;
+	default:
+		return nullptr;
+	}
+}
+
+// Appends `input` to `output` without its diacritics. Each code point is canonically decomposed on its own and the
+// combining marks are dropped, so unlike utf8proc_remove_accents no NFD copy of the whole string is built. Hangul
+// syllables are kept whole, as the recomposition of utf8proc_remove_accents would restore them.
+static void AppendStripped(const char *input, idx_t len, string &output) {
+	auto data = const_data_ptr_cast(input);
+	idx_t pos = 0;
+	while (pos < len) {
+		utf8proc_int32_t codepoint;
+		auto size = utf8proc_iterate(data + pos, UnsafeNumericCast<utf8proc_ssize_t>(len - pos), &codepoint);
+		if (size <= 0) {
+			// Not valid UTF-8: keep the byte as it is
+			output += input[pos++];
+			continue;
+		}
+		if (codepoint < 0x80 || (codepoint >= 0xAC00 && codepoint <= 0xD7A3)) {
+			output.append(input + pos, UnsafeNumericCast<idx_t>(size));
+			pos += UnsafeNumericCast<idx_t>(size);
+			continue;
+		}
+		pos += UnsafeNumericCast<idx_t>(size);
+
+		utf8proc_int32_t decomposed[8];
+		auto decomposed_count = utf8proc_decompose_char(
+		    codepoint, decomposed, 8, static_cast<utf8proc_option_t>(UTF8PROC_DECOMPOSE | UTF8PROC_STRIPMARK), nullptr);
+		if (decomposed_count < 0 || decomposed_count > 8) {
+			// Cannot happen for canonical decompositions; keep the code point rather than lose it
+			decomposed[0] = codepoint;
+			decomposed_count = 1;
+		}
+		for (utf8proc_ssize_t i = 0; i < decomposed_count; i++) {
+			utf8proc_uint8_t encoded[4];
+			auto encoded_len = utf8proc_encode_char(decomposed[i], encoded);
+			output.append(const_char_ptr_cast(encoded), UnsafeNumericCast<idx_t>(encoded_len));
+		}
+	}
+}
+
+string StripAccentsString(const string &input) {
+	if (inflector_ascii::IsAscii(input.data(), input.size())) {
+		return input;
+	}
+	string result;
+	result.reserve(input.size());
+	AppendStripped(input.data(), input.size(), result);
+	return result;
+}
+
+// Most transforms produce output close to the input size; leave room for inserted
+// separators and suffixes so that a chunk normally needs a single arena.
+static idx_t EstimateArenaSize(idx_t input_bytes, idx_t rows) {
+	return input_bytes * 2 + rows * 8;
+}
+
+// Marks the NULL rows of a VARCHAR vector invalid in the result validity
+static void MarkNulls(const UnifiedVectorFormat &input_data, idx_t count, ValidityMask &result_validity) {
+	if (input_data.validity.AllValid()) {
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (!input_data.validity.RowIsValid(input_data.sel->get_index(i))) {
+			result_validity.SetInvalid(i);
+		}
+	}
+}
+
+// Accent-stripped copies of the non-ASCII inputs of a chunk
+struct StrippedInputs {
+	//! The stripped values, back to back
+	string data;
+	//! Rows whose input points into `data` instead of the input vector
+	ValidityMask rows;
+};
+
+// Collects (pointer, length) pairs for the rows set in `rows`, which is then handed to Rust as the batch
+// validity mask. Returns the total input size in bytes. With `stripped`, the accents of non-ASCII values are
+// removed in the same pass; ASCII values have none and are used in place.
+static idx_t GatherInputs(const UnifiedVectorFormat &input_data, const ValidityMask &rows, idx_t count,
+                          vector<InflectorString> &inputs, StrippedInputs *stripped) {
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+	inputs.resize(count);
+	vector<idx_t> stripped_offsets;
+	if (stripped) {
+		stripped->data.clear();
+		stripped->rows.Initialize(count);
+		stripped->rows.SetAllInvalid(count);
+	}
+	idx_t input_bytes = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (!rows.RowIsValid(i)) {
+			inputs[i] = {nullptr, 0};
+			continue;
+		}
+		auto &value = strings[input_data.sel->get_index(i)];
+		auto data = value.GetData();
+		auto len = value.GetSize();
+		if (stripped && !inflector_ascii::IsAscii(data, len)) {
+			// `data` may still grow, so the pointer is only set once all rows are stripped
+			stripped_offsets.resize(count);
+			stripped_offsets[i] = stripped->data.size();
+			AppendStripped(data, len, stripped->data);
+			inputs[i] = {nullptr, UnsafeNumericCast<uintptr_t>(stripped->data.size() - stripped_offsets[i])};
+			stripped->rows.SetValid(i);
+		} else {
+			inputs[i] = {data, UnsafeNumericCast<uintptr_t>(len)};
+		}
+		input_bytes += inputs[i].len;
+	}
+	if (!stripped_offsets.empty()) {
+		for (idx_t i = 0; i < count; i++) {
+			if (stripped->rows.RowIsValid(i)) {
+				inputs[i].data = stripped->data.data() + stripped_offsets[i];
+			}
+		}
+	}
+	return input_bytes;
+}
+
+// Result for a row the transform left unchanged: references the input, unless it is a temporary stripped copy
+static string_t UnchangedResult(const InflectorString &input, const StrippedInputs *stripped, idx_t row,
+                                Vector &result, idx_t &passthrough) {
+	if (stripped && stripped->rows.RowIsValid(row)) {
+		return StringVector::AddString(result, input.data, input.len);
+	}
+	passthrough++;
+	return string_t(input.data, UnsafeNumericCast<uint32_t>(input.len));
+}
+
+string InflectorTransformString(InflectorTransform transform, const InflectorAcronyms &acronyms, const string &input,
+                                bool strip_accents) {
+	bool strip = strip_accents && !inflector_ascii::IsAscii(input.data(), input.size());
+	string stripped;
+	if (strip) {
+		AppendStripped(input.data(), input.size(), stripped);
+	}
+	auto &value = strip ? stripped : input;
+	InflectorString input_string {value.c_str(), UnsafeNumericCast<uintptr_t>(value.size())};
+	uintptr_t offsets[2];
+
+	string output(EstimateArenaSize(value.size(), 1), '\0');
+	while (true) {
+		InflectorArena arena {&output[0], UnsafeNumericCast<uintptr_t>(output.size()), offsets, 0};
+		if (cruet_transform_batch(transform, acronyms.Table(), &input_string, nullptr, 0, 1, &arena, nullptr) == 1) {
+			output.resize(offsets[1]);
+			return output;
+		}
+		output.resize(arena.required);
+	}
+}
+
+// Runs the ASCII kernel over every pending row that is pure ASCII, writing into a single buffer owned by the
+// result vector. Rows that the transform leaves unchanged reference the input instead. Rows that were handled are
+// removed from `pending`; returns the input bytes still pending.
+static idx_t TransformAscii(const InflectorTransformBindData &bind_data, const vector<InflectorString> &inputs,
+                           const StrippedInputs *stripped, ValidityMask &pending, idx_t input_bytes, Vector &result,
+                           idx_t count, InflectorCounters &counters) {
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	// The kernels never write more than two bytes per input byte
+	auto buffer_size = MaxValue<idx_t>(input_bytes * 2, 1);
+	auto buffer = make_buffer<VectorBuffer>(buffer_size);
+	counters.allocated_bytes += buffer_size;
+	auto output = char_ptr_cast(buffer->GetData());
+	idx_t output_len = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto &input = inputs[i];
+		if (!pending.RowIsValid(i) || !inflector_ascii::IsAscii(input.data, input.len)) {
+			continue;
+		}
+		input_bytes -= input.len;
+		pending.SetInvalid(i);
+		bool unchanged;
+		auto len = bind_data.ascii_kernel(input.data, input.len, output + output_len, *bind_data.acronyms, unchanged);
+		if (unchanged) {
+			// The output written for this row is overwritten by the next one
+			result_data[i] = UnchangedResult(input, stripped, i, result, counters.passthrough);
+			continue;
+		}
+		result_data[i] = string_t(output + output_len, UnsafeNumericCast<uint32_t>(len));
+		output_len += len;
+	}
+	if (output_len > 0) {
+		StringVector::AddBuffer(result, std::move(buffer));
+	}
+	return input_bytes;
+}
+
+// Runs the Rust transform over the rows set in `pending`. Results are written by Rust straight into a buffer
+// owned by the result vector, so every non-inlined string_t points into it and the chunk needs a single
+// allocation. If a result does not fit, Rust stops at that row and we continue in a buffer large enough for it.
+// Rows that the transform leaves unchanged reference the input instead.
+static void TransformRust(const InflectorTransformBindData &bind_data, const vector<InflectorString> &inputs,
+                          const StrippedInputs *stripped, const ValidityMask &pending, idx_t input_bytes,
+                          Vector &result, idx_t count, InflectorCounters &counters) {
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	ValidityMask unchanged(count);
+	unchanged.SetAllInvalid(count);
+	vector<uintptr_t> offsets(count + 1);
+	idx_t capacity = EstimateArenaSize(input_bytes, count);
+	idx_t start = 0;
+	while (start < count) {
+		auto buffer = make_buffer<VectorBuffer>(capacity);
+		counters.allocated_bytes += capacity;
+		InflectorArena arena {char_ptr_cast(buffer->GetData()), UnsafeNumericCast<uintptr_t>(capacity), offsets.data(),
+		                      0};
+		idx_t end;
+		{
+			counters.ffi_calls++;
+			InflectorStatsTimer timer(counters.ffi_nanos);
+			end = cruet_transform_batch(bind_data.transform_func, bind_data.acronyms->Table(), inputs.data(),
+			                            pending.GetData(), start, count, &arena, unchanged.GetData());
+		}
+		for (idx_t i = start; i < end; i++) {
+			if (!pending.RowIsValid(i)) {
+				continue;
+			}
+			if (unchanged.RowIsValid(i)) {
+				result_data[i] = UnchangedResult(inputs[i], stripped, i, result, counters.passthrough);
+				continue;
+			}
+			result_data[i] =
+			    string_t(arena.data + offsets[i], UnsafeNumericCast<uint32_t>(offsets[i + 1] - offsets[i]));
+		}
+		if (offsets[end] > 0) {
+			StringVector::AddBuffer(result, std::move(buffer));
+		}
+		start = end;
+		capacity = MaxValue<idx_t>(arena.required, EstimateArenaSize(input_bytes, count - start));
+	}
+}
+
+// Answers the pending rows whose input is already cached, removing them from `pending`
+static void LookupCached(InflectorCache &cache, const UnifiedVectorFormat &input_data, ValidityMask &pending,
+                         Vector &result, idx_t count) {
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	bool any_hit = false;
+	for (idx_t i = 0; i < count; i++) {
+		if (!pending.RowIsValid(i)) {
+			continue;
+		}
+		// Hits point into the cache's heap, which the result keeps alive
+		if (cache.Lookup(strings[input_data.sel->get_index(i)], result_data[i])) {
+			pending.SetInvalid(i);
+			any_hit = true;
+		}
+	}
+	if (any_hit) {
+		cache.KeepAlive(result);
+	}
+}
+
+// Memoizes the results of the rows set in `computed`
+static void InsertCached(InflectorCache &cache, const UnifiedVectorFormat &input_data, const ValidityMask &computed,
+                         Vector &result, idx_t count) {
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		if (computed.RowIsValid(i)) {
+			cache.Insert(strings[input_data.sel->get_index(i)], result_data[i]);
+		}
+	}
+}
+
+// Adds the sizes of the non-NULL inputs and results of a flat chunk to `counters`
+static void CountBytes(const UnifiedVectorFormat &input_data, Vector &result, idx_t count,
+                       InflectorCounters &counters) {
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		if (result_validity.RowIsValid(i)) {
+			counters.input_bytes += strings[input_data.sel->get_index(i)].GetSize();
+			counters.output_bytes += result_data[i].GetSize();
+		}
+	}
+}
+
+static void TransformFlat(const InflectorTransformBindData &bind_data, InflectorCache *cache, Vector &input,
+                          Vector &result, idx_t count, InflectorCounters &counters) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	MarkNulls(input_data, count, result_validity);
+
+	// Rows that still need a result; NULL rows never do
+	ValidityMask pending(count);
+	pending.Copy(result_validity, count);
+	if (cache) {
+		cache->Prepare(bind_data);
+		LookupCached(*cache, input_data, pending, result, count);
+	}
+	ValidityMask computed(count);
+	computed.Copy(pending, count);
+
+	vector<InflectorString> inputs;
+	StrippedInputs stripped_inputs;
+	auto stripped = bind_data.strip_accents ? &stripped_inputs : nullptr;
+	idx_t input_bytes;
+	if (stripped) {
+		InflectorStatsTimer timer(counters.strip_accents_nanos);
+		input_bytes = GatherInputs(input_data, pending, count, inputs, stripped);
+	} else {
+		input_bytes = GatherInputs(input_data, pending, count, inputs, stripped);
+	}
+
+	// Stripping accents often leaves an ASCII value, which then takes the C++ kernel as well
+	auto passthrough_before = counters.passthrough;
+	if (bind_data.ascii_kernel) {
+		input_bytes = TransformAscii(bind_data, inputs, stripped, pending, input_bytes, result, count, counters);
+	}
+	if (pending.CountValid(count) > 0) {
+		TransformRust(bind_data, inputs, stripped, pending, input_bytes, result, count, counters);
+	}
+	auto passthrough = counters.passthrough - passthrough_before;
+	if (passthrough > 0) {
+		// Unchanged rows point into the input's string data, which has to outlive the result
+		StringVector::AddHeapReference(result, input);
+	}
+	if (cache) {
+		InsertCached(*cache, input_data, computed, result, count);
+		cache->FlushStatistics(counters);
+	}
+	CountBytes(input_data, result, count, counters);
+}
+
+// Evaluates the ASCII classifier on every row that is pure ASCII, writing the booleans straight into the result.
+// Rows that were handled are removed from `pending`.
+static void PredicateAscii(const InflectorPredicateBindData &bind_data, const UnifiedVectorFormat &input_data,
+                           ValidityMask &pending, bool *result_data, idx_t count) {
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+	for (idx_t i = 0; i < count; i++) {
+		if (!pending.RowIsValid(i)) {
+			result_data[i] = false;
+			continue;
+		}
+		auto &value = strings[input_data.sel->get_index(i)];
+		auto data = value.GetData();
+		auto len = value.GetSize();
+		if (inflector_ascii::IsAscii(data, len)) {
+			result_data[i] = bind_data.ascii_predicate(data, len, *bind_data.acronyms);
+			pending.SetInvalid(i);
+		}
+	}
+}
+
+// Adds the sizes of the non-NULL inputs of a flat chunk to `counters`
+static void CountInputBytes(const UnifiedVectorFormat &input_data, const ValidityMask &rows, idx_t count,
+                            InflectorCounters &counters) {
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+	for (idx_t i = 0; i < count; i++) {
+		if (rows.RowIsValid(i)) {
+			counters.input_bytes += strings[input_data.sel->get_index(i)].GetSize();
+		}
+	}
+}
+
+static void PredicateFlat(const InflectorPredicateBindData &bind_data, Vector &input, Vector &result, idx_t count,
+                          InflectorCounters &counters) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<bool>(result);
+	auto &result_validity = FlatVector::Validity(result);
+
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	MarkNulls(input_data, count, result_validity);
+	CountInputBytes(input_data, result_validity, count, counters);
+
+	// Rows that still need a result; NULL rows never do
+	ValidityMask pending(count);
+	pending.Copy(result_validity, count);
+	if (bind_data.ascii_predicate) {
+		PredicateAscii(bind_data, input_data, pending, result_data, count);
+		if (pending.CountValid(count) == 0) {
+			return;
+		}
+	}
+
+	vector<InflectorString> inputs;
+	GatherInputs(input_data, pending, count, inputs, nullptr);
+	counters.ffi_calls++;
+	InflectorStatsTimer timer(counters.ffi_nanos);
+	cruet_predicate_batch(bind_data.predicate, bind_data.acronyms->Table(), inputs.data(), pending.GetData(), count,
+	                      result_data);
+}
+
+struct InflectorCaseField {
+	const char *name;
+	InflectorCase flag;
+};
+
+// Fields of the STRUCT returned by inflector_detect_case
+static const InflectorCaseField DETECTED_CASES[] = {{"snake", InflectorCase_Snake},
+                                                    {"kebab", InflectorCase_Kebab},
+                                                    {"camel", InflectorCase_Camel},
+                                                    {"pascal", InflectorCase_Pascal},
+                                                    {"screaming_snake", InflectorCase_ScreamingSnake},
+                                                    {"train", InflectorCase_Train},
+                                                    {"title", InflectorCase_Title},
+                                                    {"sentence", InflectorCase_Sentence},
+                                                    {"table", InflectorCase_Table},
+                                                    {"foreign_key", InflectorCase_ForeignKey}};
+
+LogicalType InflectorDetectCaseType() {
+	child_list_t<LogicalType> children;
+	for (auto &field : DETECTED_CASES) {
+		children.emplace_back(field.name, LogicalType::BOOLEAN);
+	}
+	return LogicalType::STRUCT(std::move(children));
+}
+
+static void DetectCaseFlat(const InflectorDetectCaseBindData &bind_data, InflectorLocalState &lstate, Vector &input,
+                           Vector &result, idx_t count, InflectorCounters &counters) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	MarkNulls(input_data, count, result_validity);
+	CountInputBytes(input_data, result_validity, count, counters);
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+	// InflectorCase flags per row
+	vector<uint32_t> cases(count, 0);
+	// Rows that still need to be classified in Rust; NULL rows never do
+	ValidityMask pending(count);
+	pending.Copy(result_validity, count);
+	// ASCII rows in snake case, which may also be in table case. That depends on pluralization, which is only
+	// implemented in Rust.
+	ValidityMask table_pending(count);
+	table_pending.SetAllInvalid(count);
+	if (bind_data.ascii_fast_path) {
+		for (idx_t i = 0; i < count; i++) {
+			if (!pending.RowIsValid(i)) {
+				continue;
+			}
+			auto &value = strings[input_data.sel->get_index(i)];
+			auto data = value.GetData();
+			auto len = value.GetSize();
+			if (!inflector_ascii::IsAscii(data, len)) {
+				continue;
+			}
+			cases[i] = inflector_ascii::DetectCases(data, len, *bind_data.acronyms, lstate.words);
+			if (cases[i] & InflectorCase_Snake) {
+				table_pending.SetValid(i);
+			}
+			pending.SetInvalid(i);
+		}
+	}
+
+	vector<InflectorString> inputs;
+	if (pending.CountValid(count) > 0) {
+		GatherInputs(input_data, pending, count, inputs, nullptr);
+		counters.ffi_calls++;
+		InflectorStatsTimer timer(counters.ffi_nanos);
+		cruet_detect_case_batch(bind_data.acronyms->Table(), inputs.data(), pending.GetData(), count, cases.data());
+	}
+	if (table_pending.CountValid(count) > 0) {
+		GatherInputs(input_data, table_pending, count, inputs, nullptr);
+		auto is_table = make_unsafe_uniq_array<bool>(count);
+		{
+			counters.ffi_calls++;
+			InflectorStatsTimer timer(counters.ffi_nanos);
+			cruet_predicate_batch(InflectorPredicate_TableCase, bind_data.acronyms->Table(), inputs.data(),
+			                      table_pending.GetData(), count, is_table.get());
+		}
+		for (idx_t i = 0; i < count; i++) {
+			if (table_pending.RowIsValid(i) && is_table[i]) {
+				cases[i] |= InflectorCase_Table;
+			}
+		}
+	}
+
+	auto &children = StructVector::GetEntries(result);
+	for (idx_t field_idx = 0; field_idx < children.size(); field_idx++) {
+		auto &child = *children[field_idx];
+		auto child_data = FlatVector::GetData<bool>(child);
+		auto &child_validity = FlatVector::Validity(child);
+		auto flag = DETECTED_CASES[field_idx].flag;
+		for (idx_t i = 0; i < count; i++) {
+			child_data[i] = (cases[i] & flag) != 0;
+		}
+		if (!result_validity.AllValid()) {
+			child_validity.Copy(result_validity, count);
+		}
+	}
+}
+
+struct InflectorTransformField {
+	const char *name;
+	InflectorTransform transform;
+};
+
+// Fields of the STRUCT returned by inflect_all; the last two are only included on request
+static const InflectorTransformField INFLECT_ALL_FIELDS[] = {{"snake", InflectorTransform_SnakeCase},
+                                                             {"kebab", InflectorTransform_KebabCase},
+                                                             {"screaming_snake", InflectorTransform_ScreamingSnakeCase},
+                                                             {"camel", InflectorTransform_CamelCase},
+                                                             {"pascal", InflectorTransform_PascalCase},
+                                                             {"train", InflectorTransform_TrainCase},
+                                                             {"title", InflectorTransform_TitleCase},
+                                                             {"sentence", InflectorTransform_SentenceCase},
+                                                             {"plural", InflectorTransform_Plural},
+                                                             {"singular", InflectorTransform_Singular}};
+static constexpr idx_t INFLECT_ALL_NUMBER_FIELDS = 2;
+
+static idx_t InflectAllFieldCount(bool include_number) {
+	auto field_count = sizeof(INFLECT_ALL_FIELDS) / sizeof(INFLECT_ALL_FIELDS[0]);
+	return include_number ? field_count : field_count - INFLECT_ALL_NUMBER_FIELDS;
+}
+
+LogicalType InflectAllType(bool include_number) {
+	child_list_t<LogicalType> children;
+	for (idx_t field_idx = 0; field_idx < InflectAllFieldCount(include_number); field_idx++) {
+		children.emplace_back(INFLECT_ALL_FIELDS[field_idx].name, LogicalType::VARCHAR);
+	}
+	return LogicalType::STRUCT(std::move(children));
+}
+
+unique_ptr<InflectAllBindData> InflectAllBindData::Create(ClientContext &context, bool include_number) {
+	vector<InflectorTransform> transforms;
+	for (idx_t field_idx = 0; field_idx < InflectAllFieldCount(include_number); field_idx++) {
+		transforms.push_back(INFLECT_ALL_FIELDS[field_idx].transform);
+	}
+	return make_uniq<InflectAllBindData>(std::move(transforms), UseAsciiFastPath(context),
+	                                     InflectorGetAcronyms(context));
+}
+
+// Renders the fields that have an ASCII renderer for every pending row that is pure ASCII, splitting each row into
+// words once. Rows that were handled move from `pending` to `ascii_rows`; returns the input bytes still pending.
+static idx_t InflectAllAscii(const InflectAllBindData &bind_data, InflectorLocalState &lstate,
+                             const vector<inflector_ascii_renderer_t> &renderers,
+                             const vector<InflectorString> &inputs, ValidityMask &pending, ValidityMask &ascii_rows,
+                             idx_t input_bytes, vector<unique_ptr<Vector>> &children, idx_t count,
+                             InflectorCounters &counters) {
+	// One buffer per field; the renderers never write more than two bytes per input byte
+	vector<buffer_ptr<VectorBuffer>> buffers(renderers.size());
+	auto buffer_size = MaxValue<idx_t>(input_bytes * 2, 1);
+	for (idx_t field_idx = 0; field_idx < renderers.size(); field_idx++) {
+		if (renderers[field_idx]) {
+			buffers[field_idx] = make_buffer<VectorBuffer>(buffer_size);
+			counters.allocated_bytes += buffer_size;
+		}
+	}
+	idx_t output_len = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto &input = inputs[i];
+		if (!pending.RowIsValid(i) || !inflector_ascii::IsAscii(input.data, input.len)) {
+			continue;
+		}
+		inflector_ascii::SplitWords(input.data, input.len, *bind_data.acronyms, lstate.words);
+		idx_t row_len = 0;
+		for (idx_t field_idx = 0; field_idx < renderers.size(); field_idx++) {
+			if (!renderers[field_idx]) {
+				continue;
+			}
+			// Each field is at most twice the input, so rows stay at the same offset in every buffer
+			auto output = char_ptr_cast(buffers[field_idx]->GetData()) + output_len;
+			auto len = renderers[field_idx](lstate.words, output);
+			FlatVector::GetData<string_t>(*children[field_idx])[i] = string_t(output, UnsafeNumericCast<uint32_t>(len));
+			row_len = MaxValue<idx_t>(row_len, len);
+		}
+		output_len += MaxValue<idx_t>(row_len, input.len * 2);
+		input_bytes -= input.len;
+		pending.SetInvalid(i);
+		ascii_rows.SetValid(i);
+	}
+	if (output_len > 0) {
+		for (idx_t field_idx = 0; field_idx < renderers.size(); field_idx++) {
+			if (buffers[field_idx]) {
+				StringVector::AddBuffer(*children[field_idx], std::move(buffers[field_idx]));
+			}
+		}
+	}
+	return input_bytes;
+}
+
+// Computes `fields` of inflect_all in Rust for the rows set in `rows`, with one call per chunk that splits every
+// value into words once. Like TransformRust, results are written straight into buffers owned by the child vectors.
+static void InflectAllRust(const InflectAllBindData &bind_data, const vector<idx_t> &fields,
+                           const vector<InflectorString> &inputs, const ValidityMask &rows, idx_t input_bytes,
+                           vector<unique_ptr<Vector>> &children, idx_t count, InflectorCounters &counters) {
+	vector<InflectorTransform> transforms;
+	for (auto field_idx : fields) {
+		transforms.push_back(bind_data.transforms[field_idx]);
+	}
+	vector<vector<uintptr_t>> offsets(fields.size(), vector<uintptr_t>(count + 1));
+	vector<InflectorArena> arenas(fields.size());
+	vector<idx_t> capacities(fields.size(), EstimateArenaSize(input_bytes, count));
+	vector<buffer_ptr<VectorBuffer>> buffers(fields.size());
+
+	idx_t start = 0;
+	while (start < count) {
+		for (idx_t k = 0; k < fields.size(); k++) {
+			buffers[k] = make_buffer<VectorBuffer>(capacities[k]);
+			counters.allocated_bytes += capacities[k];
+			arenas[k] = {char_ptr_cast(buffers[k]->GetData()), UnsafeNumericCast<uintptr_t>(capacities[k]),
+			             offsets[k].data(), 0};
+		}
+		idx_t end;
+		{
+			counters.ffi_calls++;
+			InflectorStatsTimer timer(counters.ffi_nanos);
+			end = cruet_transform_multi_batch(transforms.data(), transforms.size(), bind_data.acronyms->Table(),
+			                                  inputs.data(), rows.GetData(), start, count, arenas.data());
+		}
+		for (idx_t k = 0; k < fields.size(); k++) {
+			auto &child = *children[fields[k]];
+			auto result_data = FlatVector::GetData<string_t>(child);
+			auto &field_offsets = offsets[k];
+			for (idx_t i = start; i < end; i++) {
+				if (rows.RowIsValid(i)) {
+					result_data[i] = string_t(arenas[k].data + field_offsets[i],
+					                          UnsafeNumericCast<uint32_t>(field_offsets[i + 1] - field_offsets[i]));
+				}
+			}
+			StringVector::AddBuffer(child, std::move(buffers[k]));
+		}
+		start = end;
+		for (idx_t k = 0; k < fields.size(); k++) {
+			capacities[k] = MaxValue<idx_t>(arenas[k].required, EstimateArenaSize(input_bytes, count - start));
+		}
+	}
+}
+
+static void InflectAllFlat(const InflectAllBindData &bind_data, InflectorLocalState &lstate, Vector &input,
+                           Vector &result, idx_t count, InflectorCounters &counters) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+	auto &children = StructVector::GetEntries(result);
+
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	MarkNulls(input_data, count, result_validity);
+
+	// Rows that still need a result; NULL rows never do
+	ValidityMask pending(count);
+	pending.Copy(result_validity, count);
+	vector<InflectorString> inputs;
+	auto input_bytes = GatherInputs(input_data, pending, count, inputs, nullptr);
+	counters.input_bytes += input_bytes;
+
+	// Fields without an ASCII renderer are computed in Rust for every row
+	vector<inflector_ascii_renderer_t> renderers(bind_data.transforms.size());
+	vector<idx_t> all_fields;
+	vector<idx_t> rust_fields;
+	for (idx_t field_idx = 0; field_idx < bind_data.transforms.size(); field_idx++) {
+		if (bind_data.ascii_fast_path) {
+			renderers[field_idx] = InflectorGetAsciiRenderer(bind_data.transforms[field_idx]);
+		}
+		if (!renderers[field_idx]) {
+			rust_fields.push_back(field_idx);
+		}
+		all_fields.push_back(field_idx);
+	}
+
+	ValidityMask ascii_rows(count);
+	ascii_rows.SetAllInvalid(count);
+	idx_t ascii_bytes = 0;
+	if (rust_fields.size() < all_fields.size()) {
+		auto remaining_bytes =
+		    InflectAllAscii(bind_data, lstate, renderers, inputs, pending, ascii_rows, input_bytes, children, count,
+		                    counters);
+		ascii_bytes = input_bytes - remaining_bytes;
+		input_bytes = remaining_bytes;
+	}
+	if (pending.CountValid(count) > 0) {
+		InflectAllRust(bind_data, all_fields, inputs, pending, input_bytes, children, count, counters);
+	}
+	if (!rust_fields.empty() && ascii_rows.CountValid(count) > 0) {
+		InflectAllRust(bind_data, rust_fields, inputs, ascii_rows, ascii_bytes, children, count, counters);
+	}
+
+	for (auto &child : children) {
+		auto child_data = FlatVector::GetData<string_t>(*child);
+		for (idx_t i = 0; i < count; i++) {
+			if (result_validity.RowIsValid(i)) {
+				counters.output_bytes += child_data[i].GetSize();
+			}
+		}
+	}
+	if (!result_validity.AllValid()) {
+		for (auto &child : children) {
+			FlatVector::Validity(*child).Copy(result_validity, count);
+		}
+	}
+}
+
+InflectorCache::InflectorCache(idx_t capacity_p)
+    : capacity(capacity_p), transform_func(InflectorTransform_SnakeCase), strip_accents(false), acronym_fingerprint(0),
+      heap(make_buffer<VectorStringBuffer>()), hits(0), misses(0), evictions(0) {
+}
+
+void InflectorCache::Clear() {
+	if (entries.empty()) {
+		return;
+	}
+	evictions += entries.size();
+	entries.clear();
+	heap = make_buffer<VectorStringBuffer>();
+}
+
+void InflectorCache::Prepare(const InflectorTransformBindData &bind_data) {
+	if (transform_func == bind_data.transform_func && strip_accents == bind_data.strip_accents &&
+	    acronym_fingerprint == bind_data.acronyms->fingerprint) {
+		return;
+	}
+	Clear();
+	transform_func = bind_data.transform_func;
+	strip_accents = bind_data.strip_accents;
+	acronym_fingerprint = bind_data.acronyms->fingerprint;
+}
+
+void InflectorCache::KeepAlive(Vector &result) {
+	StringVector::AddBuffer(result, heap);
+}
+
+bool InflectorCache::Lookup(const string_t &input, string_t &output) {
+	auto entry = entries.find(input);
+	if (entry == entries.end()) {
+		misses++;
+		return false;
+	}
+	hits++;
+	output = entry->second;
+	return true;
+}
+
+void InflectorCache::Insert(const string_t &input, const string_t &output) {
+	if (capacity == 0 || entries.find(input) != entries.end()) {
+		return;
+	}
+	if (entries.size() >= capacity) {
+		Clear();
+	}
+	entries.emplace(heap->AddBlob(input), heap->AddBlob(output));
+}
+
+void InflectorCache::FlushStatistics(InflectorCounters &counters) {
+	counters.cache_hits += hits;
+	counters.cache_misses += misses;
+	counters.cache_evictions += evictions;
+	hits = 0;
+	misses = 0;
+	evictions = 0;
+}
+
+InflectorCacheStatistics InflectorCache::GetStatistics() {
+	InflectorCacheStatistics totals {0, 0, 0, 0};
+	for (auto &counters : InflectorStatsShard::GetStatistics()) {
+		totals.hits += counters.cache_hits;
+		totals.misses += counters.cache_misses;
+		totals.evictions += counters.cache_evictions;
+		totals.passthrough += counters.passthrough;
+	}
+	return totals;
+}
+
+// Bind results are small, so these bounds only guard against unbounded growth from generated names. Like the
+// per-thread caches, a full cache is cleared rather than evicting single entries.
+static constexpr idx_t BIND_CACHE_NAME_CAPACITY = 100000;
+static constexpr idx_t BIND_CACHE_TYPE_CAPACITY = 1000;
+
+template <class T>
+struct InflectorBindKey {
+	InflectorTransform transform;
+	bool strip_accents;
+	hash_t acronym_fingerprint;
+	T input;
+
+	bool operator==(const InflectorBindKey &other) const {
+		return transform == other.transform && strip_accents == other.strip_accents &&
+		       acronym_fingerprint == other.acronym_fingerprint && input == other.input;
+	}
+};
+
+static hash_t HashBindInput(const string &name) {
+	return Hash(name.c_str(), name.size());
+}
+
+static hash_t HashBindInput(const LogicalType &type) {
+	return type.Hash();
+}
+
+template <class T>
+struct InflectorBindKeyHash {
+	size_t operator()(const InflectorBindKey<T> &key) const {
+		auto hash = CombineHash(Hash(static_cast<int32_t>(key.transform)), Hash(key.strip_accents));
+		return CombineHash(CombineHash(hash, key.acronym_fingerprint), HashBindInput(key.input));
+	}
+};
+
+static mutex bind_cache_lock;
+static unordered_map<InflectorBindKey<string>, string, InflectorBindKeyHash<string>> bind_cache_names;
+static unordered_map<InflectorBindKey<LogicalType>, LogicalType, InflectorBindKeyHash<LogicalType>> bind_cache_types;
+
+string InflectorBindCache::TransformName(InflectorTransform transform, const InflectorAcronyms &acronyms,
+                                         const string &name, bool strip_accents) {
+	InflectorBindKey<string> key {transform, strip_accents, acronyms.fingerprint, name};
+	{
+		lock_guard<mutex> guard(bind_cache_lock);
+		auto entry = bind_cache_names.find(key);
+		if (entry != bind_cache_names.end()) {
+			return entry->second;
+		}
+	}
+	auto result = InflectorTransformString(transform, acronyms, name, strip_accents);
+	lock_guard<mutex> guard(bind_cache_lock);
+	if (bind_cache_names.size() >= BIND_CACHE_NAME_CAPACITY) {
+		bind_cache_names.clear();
+	}
+	bind_cache_names.emplace(std::move(key), result);
+	return result;
+}
+
+LogicalType InflectorBindCache::InflectType(InflectorTransform transform, const InflectorAcronyms &acronyms,
+                                            const LogicalType &type, bool strip_accents,
+                                            const std::function<LogicalType()> &inflect) {
+	InflectorBindKey<LogicalType> key {transform, strip_accents, acronyms.fingerprint, type};
+	{
+		lock_guard<mutex> guard(bind_cache_lock);
+		auto entry = bind_cache_types.find(key);
+		if (entry != bind_cache_types.end()) {
+			return entry->second;
+		}
+	}
+	// Computed without the lock, since inflecting the type looks up names in the same cache
+	auto result = inflect();
+	lock_guard<mutex> guard(bind_cache_lock);
+	if (bind_cache_types.size() >= BIND_CACHE_TYPE_CAPACITY) {
+		bind_cache_types.clear();
+	}
+	bind_cache_types.emplace(std::move(key), result);
+	return result;
+}
+
+void InflectorLocalState::AddStatistics(idx_t slot, const InflectorCounters &chunk) {
+	if (!stats) {
+		stats = make_uniq<InflectorStatsShard>(slot);
+	}
+	stats->Add(chunk);
+	if (profile) {
+		lock_guard<mutex> guard(profile->lock);
+		profile->data.counters.Add(chunk);
+	}
+}
+
+unique_ptr<FunctionLocalState> InflectorLocalState::Init(ExpressionState &state, const BoundFunctionExpression &expr,
+                                                         FunctionData *bind_data) {
+	auto lstate = make_uniq<InflectorLocalState>();
+	lstate->profile = InflectorProfile::Register(state.GetContext(), expr);
+	return std::move(lstate);
+}
+
+unique_ptr<FunctionLocalState> InflectorLocalState::InitTransform(ExpressionState &state,
+                                                                  const BoundFunctionExpression &expr,
+                                                                  FunctionData *bind_data) {
+	auto lstate = make_uniq<InflectorLocalState>();
+	lstate->profile = InflectorProfile::Register(state.GetContext(), expr);
+	auto cache_size = bind_data->Cast<InflectorTransformBindData>().cache_size;
+	if (cache_size > 0) {
+		lstate->cache = make_uniq<InflectorCache>(cache_size);
+	}
+	return std::move(lstate);
+}
+
+// Appends `value` to `output` as the contents of a JSON string literal
+static void AppendJsonEscaped(const string &value, string &output) {
+	static const char HEX_DIGITS[] = "0123456789abcdef";
+	for (auto c : value) {
+		auto byte = static_cast<unsigned char>(c);
+		if (c == '"' || c == '\\') {
+			output += '\\';
+			output += c;
+		} else if (byte < 0x20) {
+			output += "\\u00";
+			output += HEX_DIGITS[byte >> 4];
+			output += HEX_DIGITS[byte & 0xF];
+		} else {
+			output += c;
+		}
+	}
+}
+
+// Decodes a JSON string literal, including its quotes, that contains escape sequences
+static string DecodeJsonString(const char *literal, idx_t len) {
+	auto doc = duckdb_yyjson::yyjson_read(literal, len, 0);
+	auto root = duckdb_yyjson::yyjson_doc_get_root(doc);
+	if (!duckdb_yyjson::yyjson_is_str(root)) {
+		duckdb_yyjson::yyjson_doc_free(doc);
+		throw InvalidInputException("inflect: malformed JSON key %s", string(literal, len));
+	}
+	string value(duckdb_yyjson::yyjson_get_str(root), duckdb_yyjson::yyjson_get_len(root));
+	duckdb_yyjson::yyjson_doc_free(doc);
+	return value;
+}
+
+static bool IsJsonWhitespace(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Same flags as the JSON extension, so that inflect() accepts what a JSON value may hold
+static constexpr duckdb_yyjson::yyjson_read_flag JSON_READ_FLAG =
+    duckdb_yyjson::YYJSON_READ_ALLOW_INF_AND_NAN | duckdb_yyjson::YYJSON_READ_ALLOW_TRAILING_COMMAS;
+
+// Raises the error the JSON functions raise for a malformed document. JSON values are validated when they are cast
+// from text, but not every producer of JSON values (e.g. a Parquet column of the JSON type) does so.
+static void ValidateJson(const string_t &value) {
+	duckdb_yyjson::yyjson_read_err error;
+	auto doc = duckdb_yyjson::yyjson_read_opts(const_cast<char *>(value.GetData()), value.GetSize(), JSON_READ_FLAG,
+	                                           nullptr, &error);
+	if (!doc) {
+		throw InvalidInputException("Malformed JSON at byte %d of input: %s. Input: %s", error.pos, error.msg,
+		                            value.GetString());
+	}
+	duckdb_yyjson::yyjson_doc_free(doc);
+}
+
+// Scans a valid JSON document once, calling `key(raw_key, literal, literal_len, escaped)` for every object key and
+// `text(data, len)` for everything in between. A string literal is a key exactly when the next token is a colon;
+// `raw_key` is its contents as written, `literal` includes the quotes.
+template <class KEY, class TEXT>
+static void ScanJson(const string_t &value, KEY &&key, TEXT &&text) {
+	auto data = value.GetData();
+	auto len = value.GetSize();
+	idx_t pos = 0;
+	while (pos < len) {
+		auto quote = static_cast<const char *>(memchr(data + pos, '"', len - pos));
+		if (!quote) {
+			text(data + pos, len - pos);
+			break;
+		}
+		auto start = idx_t(quote - data);
+		text(data + pos, start - pos);
+
+		// Find the closing quote, skipping escaped characters
+		bool escaped = false;
+		idx_t end = start + 1;
+		while (end < len && data[end] != '"') {
+			if (data[end] == '\\') {
+				escaped = true;
+				end++;
+			}
+			end++;
+		}
+		if (end >= len) {
+			throw InvalidInputException("inflect: unterminated string in JSON value %s", value.GetString());
+		}
+		pos = end + 1;
+
+		auto next = pos;
+		while (next < len && IsJsonWhitespace(data[next])) {
+			next++;
+		}
+		if (next >= len || data[next] != ':') {
+			text(data + start, pos - start);
+			continue;
+		}
+		string_t raw_key(data + start + 1, UnsafeNumericCast<uint32_t>(end - start - 1));
+		key(raw_key, data + start, pos - start, escaped);
+	}
+}
+
+// Transforms `keys` through the same path as the values of a VARCHAR column, so that they use the ASCII kernels,
+// the per-thread cache and the statistics, and returns each result encoded as the contents of a JSON string literal
+static vector<string> TransformJsonKeys(const InflectorTransformBindData &bind_data, InflectorCache *cache,
+                                        const vector<string> &keys, InflectorCounters &counters) {
+	vector<string> encoded(keys.size());
+	InflectorCounters key_counters;
+	for (idx_t offset = 0; offset < keys.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto batch = MinValue<idx_t>(STANDARD_VECTOR_SIZE, keys.size() - offset);
+		Vector input(LogicalType::VARCHAR, batch);
+		Vector result(LogicalType::VARCHAR, batch);
+		auto input_data = FlatVector::GetData<string_t>(input);
+		for (idx_t i = 0; i < batch; i++) {
+			auto &key = keys[offset + i];
+			input_data[i] = string_t(key.c_str(), UnsafeNumericCast<uint32_t>(key.size()));
+		}
+		TransformFlat(bind_data, cache, input, result, batch, key_counters);
+		auto result_data = FlatVector::GetData<string_t>(result);
+		for (idx_t i = 0; i < batch; i++) {
+			AppendJsonEscaped(result_data[i].GetString(), encoded[offset + i]);
+		}
+	}
+	// Bytes and rows are counted for the documents, not for their keys
+	counters.allocated_bytes += key_counters.allocated_bytes;
+	counters.ffi_calls += key_counters.ffi_calls;
+	counters.ffi_nanos += key_counters.ffi_nanos;
+	counters.strip_accents_nanos += key_counters.strip_accents_nanos;
+	counters.cache_hits += key_counters.cache_hits;
+	counters.cache_misses += key_counters.cache_misses;
+	counters.cache_evictions += key_counters.cache_evictions;
+	return encoded;
+}
+
+// Copies each JSON document to the result, replacing every object key with its transformed form. The documents are
+// scanned twice: once to collect the distinct keys of the chunk, which are then transformed together, and once to
+// write the output. Everything but the keys is copied verbatim.
+static void InflectJsonFlat(const InflectorTransformBindData &bind_data, InflectorCache *cache, Vector &input,
+                            Vector &result, idx_t count, InflectorCounters &counters) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &result_validity = FlatVector::Validity(result);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	auto strings = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+	// Keys as written in the input, which they point into, mapped to their index in `keys`
+	string_map_t<idx_t> key_indexes;
+	vector<string> keys;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (!input_data.validity.RowIsValid(idx)) {
+			continue;
+		}
+		ValidateJson(strings[idx]);
+		ScanJson(
+		    strings[idx],
+		    [&](const string_t &raw_key, const char *literal, idx_t literal_len, bool escaped) {
+			    if (key_indexes.find(raw_key) == key_indexes.end()) {
+				    key_indexes.emplace(raw_key, keys.size());
+				    keys.push_back(escaped ? DecodeJsonString(literal, literal_len) : raw_key.GetString());
+			    }
+		    },
+		    [](const char *, idx_t) {});
+	}
+	auto encoded_keys = TransformJsonKeys(bind_data, cache, keys, counters);
+
+	string output;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (!input_data.validity.RowIsValid(idx)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		output.clear();
+		ScanJson(
+		    strings[idx],
+		    [&](const string_t &raw_key, const char *, idx_t, bool) {
+			    output += '"';
+			    output += encoded_keys[key_indexes[raw_key]];
+			    output += '"';
+		    },
+		    [&](const char *text, idx_t len) { output.append(text, len); });
+		result_data[i] = StringVector::AddString(result, output);
+		counters.input_bytes += strings[idx].GetSize();
+		counters.output_bytes += output.size();
+		counters.allocated_bytes += output.size();
+	}
+}
+
+// Evaluates `execute(input, result, count)` on distinct values only: once for a constant vector, and once per
+// dictionary entry for a dictionary vector, whose result is then a dictionary over the same selection vector.
+// Dictionaries that carry an id (e.g. from a parquet column chunk) are transformed once across chunks.
+template <class EXECUTE>
+static void ExecuteDistinct(InflectorLocalState &lstate, Vector &input, Vector &result, idx_t count,
+                            EXECUTE &&execute) {
+	switch (input.GetVectorType()) {
+	case VectorType::CONSTANT_VECTOR:
+		execute(input, result, 1);
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		return;
+	case VectorType::DICTIONARY_VECTOR: {
+		auto dictionary_size = DictionaryVector::DictionarySize(input);
+		if (!dictionary_size.IsValid()) {
+			break;
+		}
+		auto &dictionary_id = DictionaryVector::DictionaryId(input);
+		bool cached = lstate.dictionary && !dictionary_id.empty() && lstate.dictionary_id == dictionary_id;
+		if (!cached) {
+			if (dictionary_size.GetIndex() > count) {
+				// Transforming the rows is cheaper than transforming the whole dictionary
+				break;
+			}
+			auto dictionary = make_uniq<Vector>(result.GetType(), dictionary_size.GetIndex());
+			execute(DictionaryVector::Child(input), *dictionary, dictionary_size.GetIndex());
+			lstate.dictionary = std::move(dictionary);
+			lstate.dictionary_id = dictionary_id;
+		}
+		result.Slice(*lstate.dictionary, DictionaryVector::SelVector(input), count);
+		return;
+	}
+	default:
+		break;
+	}
+	execute(input, result, count);
+}
+
+// Runs `execute(counters)` on a chunk and adds its counters to this thread's statistics for `slot`, once per chunk.
+// Every row and NULL of the chunk is counted, even when only its distinct values are evaluated.
+template <class EXECUTE>
+static void ExecuteCounted(InflectorLocalState &lstate, idx_t slot, Vector &input, idx_t count, EXECUTE &&execute) {
+	InflectorCounters counters;
+	counters.calls = 1;
+	counters.rows = count;
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	if (!input_data.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			if (!input_data.validity.RowIsValid(input_data.sel->get_index(i))) {
+				counters.nulls++;
+			}
+		}
+	}
+	try {
+		InflectorStatsTimer timer(counters.nanos);
+		execute(counters);
+	} catch (...) {
+		counters.errors++;
+		lstate.AddStatistics(slot, counters);
+		throw;
+	}
+	lstate.AddStatistics(slot, counters);
+}
+
+void InflectorExecuteTransform(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate,
+                               Vector &input, Vector &result, idx_t count) {
+	auto slot = InflectorStatsSlot::Transform(bind_data.transform_func);
+	ExecuteCounted(lstate, slot, input, count, [&](InflectorCounters &counters) {
+		ExecuteDistinct(lstate, input, result, count, [&](Vector &input, Vector &result, idx_t count) {
+			TransformFlat(bind_data, lstate.cache.get(), input, result, count, counters);
+		});
+	});
+}
+
+void InflectorExecutePredicate(const InflectorPredicateBindData &bind_data, InflectorLocalState &lstate,
+                               Vector &input, Vector &result, idx_t count) {
+	auto slot = InflectorStatsSlot::Predicate(bind_data.predicate);
+	ExecuteCounted(lstate, slot, input, count, [&](InflectorCounters &counters) {
+		ExecuteDistinct(lstate, input, result, count, [&](Vector &input, Vector &result, idx_t count) {
+			PredicateFlat(bind_data, input, result, count, counters);
+		});
+	});
+}
+
+void InflectorExecuteDetectCase(const InflectorDetectCaseBindData &bind_data, InflectorLocalState &lstate,
+                                Vector &input, Vector &result, idx_t count) {
+	ExecuteCounted(lstate, InflectorStatsSlot::DetectCase(), input, count, [&](InflectorCounters &counters) {
+		ExecuteDistinct(lstate, input, result, count, [&](Vector &input, Vector &result, idx_t count) {
+			DetectCaseFlat(bind_data, lstate, input, result, count, counters);
+		});
+	});
+}
+
+void InflectorExecuteJson(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate, Vector &input,
+                          Vector &result, idx_t count) {
+	auto slot = InflectorStatsSlot::Transform(bind_data.transform_func);
+	ExecuteCounted(lstate, slot, input, count, [&](InflectorCounters &counters) {
+		ExecuteDistinct(lstate, input, result, count, [&](Vector &input, Vector &result, idx_t count) {
+			InflectJsonFlat(bind_data, lstate.cache.get(), input, result, count, counters);
+		});
+	});
+}
+
+void InflectorTransformMapKeys(const InflectorTransformBindData &bind_data, InflectorLocalState &lstate, Vector &map,
+                               Vector &keys, idx_t count) {
+	auto key_count = ListVector::GetListSize(map);
+	if (key_count == 0) {
+		return;
+	}
+	UnifiedVectorFormat key_data;
+	keys.ToUnifiedFormat(key_count, key_data);
+	auto key_strings = UnifiedVectorFormat::GetData<string_t>(key_data);
+
+	// Number the distinct keys of the chunk; map keys are never NULL
+	string_map_t<sel_t> distinct_index;
+	vector<string_t> distinct_keys;
+	SelectionVector key_sel(key_count);
+	for (idx_t i = 0; i < key_count; i++) {
+		auto &key = key_strings[key_data.sel->get_index(i)];
+		auto entry = distinct_index.emplace(key, UnsafeNumericCast<sel_t>(distinct_keys.size()));
+		if (entry.second) {
+			distinct_keys.push_back(key);
+		}
+		key_sel.set_index(i, entry.first->second);
+	}
+
+	// Transform each distinct key once
+	Vector distinct(LogicalType::VARCHAR, distinct_keys.size());
+	auto distinct_data = FlatVector::GetData<string_t>(distinct);
+	for (idx_t i = 0; i < distinct_keys.size(); i++) {
+		distinct_data[i] = distinct_keys[i];
+	}
+	StringVector::AddHeapReference(distinct, keys);
+	Vector transformed(LogicalType::VARCHAR, distinct_keys.size());
+	InflectorExecuteTransform(bind_data, lstate, distinct, transformed, distinct_keys.size());
+
+	// Different keys can become equal (userId and user_id); a map must not end up with the same key twice
+	auto transformed_data = FlatVector::GetData<string_t>(transformed);
+	string_map_t<idx_t> output_index;
+	vector<idx_t> output_of(distinct_keys.size());
+	for (idx_t i = 0; i < distinct_keys.size(); i++) {
+		output_of[i] = output_index.emplace(transformed_data[i], output_index.size()).first->second;
+	}
+	if (output_index.size() == distinct_keys.size()) {
+		keys.Slice(transformed, key_sel, key_count);
+		return;
+	}
+
+	// Maps whose keys would collide keep their original keys, which follow the transformed keys in `combined`
+	Vector combined(LogicalType::VARCHAR, 2 * distinct_keys.size());
+	auto combined_data = FlatVector::GetData<string_t>(combined);
+	for (idx_t i = 0; i < distinct_keys.size(); i++) {
+		combined_data[i] = transformed_data[i];
+		combined_data[distinct_keys.size() + i] = distinct_keys[i];
+	}
+	StringVector::AddHeapReference(combined, transformed);
+	StringVector::AddHeapReference(combined, keys);
+
+	UnifiedVectorFormat map_data;
+	map.ToUnifiedFormat(count, map_data);
+	auto entries = UnifiedVectorFormat::GetData<list_entry_t>(map_data);
+	vector<idx_t> seen_in_row(output_index.size(), DConstants::INVALID_INDEX);
+	for (idx_t row = 0; row < count; row++) {
+		auto idx = map_data.sel->get_index(row);
+		if (!map_data.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto &entry = entries[idx];
+		bool collides = false;
+		for (idx_t i = entry.offset; i < entry.offset + entry.length && !collides; i++) {
+			auto output = output_of[key_sel.get_index(i)];
+			collides = seen_in_row[output] == row;
+			seen_in_row[output] = row;
+		}
+		if (!collides) {
+			continue;
+		}
+		for (idx_t i = entry.offset; i < entry.offset + entry.length; i++) {
+			auto distinct_idx = key_sel.get_index(i);
+			if (distinct_idx < distinct_keys.size()) {
+				key_sel.set_index(i, distinct_keys.size() + distinct_idx);
+			}
+		}
+	}
+	keys.Slice(combined, key_sel, key_count);
+}
+
+void InflectorExecuteInflectAll(const InflectAllBindData &bind_data, InflectorLocalState &lstate, Vector &input,
+                                Vector &result, idx_t count) {
+	ExecuteCounted(lstate, InflectorStatsSlot::InflectAll(), input, count, [&](InflectorCounters &counters) {
+		ExecuteDistinct(lstate, input, result, count, [&](Vector &input, Vector &result, idx_t count) {
+			InflectAllFlat(bind_data, lstate, input, result, count, counters);
+		});
+	});
+}
+
+} // namespace duckdb
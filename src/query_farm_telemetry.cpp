@@ -1,12 +1,13 @@
 #include "query_farm_telemetry.hpp"
 #include <thread>
 #include "duckdb.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/http_util.hpp"
 #include "yyjson.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/main/config.hpp"
+#include <atomic>
 #include <cstdlib>
-#include <future>
 using namespace duckdb_yyjson; // NOLINT
 
 namespace duckdb
@@ -15,31 +16,93 @@ namespace duckdb
 	namespace
 	{
 
-		// Function to send the actual HTTP request
-		void sendHTTPRequest(shared_ptr<DatabaseInstance> db, char *json_body, size_t json_body_size)
+		// Telemetry is best effort: a request that takes longer than this is abandoned
+		constexpr uint64_t TELEMETRY_TIMEOUT_SECONDS = 3;
+
+		// Function to send the actual HTTP request. Never throws: setting up the request can fail as well, e.g. on a
+		// bad proxy configuration, and telemetry must not fail the caller.
+		void sendHTTPRequest(DatabaseInstance &db, const char *json_body, size_t json_body_size)
 		{
 			const string TARGET_URL("https://duckdb-in.query-farm.services/");
 
-			HTTPHeaders headers;
-			headers.Insert("Content-Type", "application/json");
-
-			auto &http_util = HTTPUtil::Get(*db);
-			unique_ptr<HTTPParams> params = http_util.InitializeParameters(*db, TARGET_URL);
-
-			PostRequestInfo post_request(TARGET_URL, headers, *params, reinterpret_cast<const_data_ptr_t>(json_body),
-																	 json_body_size);
 			try
 			{
+				HTTPHeaders headers;
+				headers.Insert("Content-Type", "application/json");
+
+				auto &http_util = HTTPUtil::Get(db);
+				unique_ptr<HTTPParams> params = http_util.InitializeParameters(db, TARGET_URL);
+				params->timeout = TELEMETRY_TIMEOUT_SECONDS;
+				params->retries = 0;
+
+				PostRequestInfo post_request(TARGET_URL, headers, *params, reinterpret_cast<const_data_ptr_t>(json_body),
+																		 json_body_size);
 				auto response = http_util.Request(post_request);
 			}
-			catch (const std::exception &e)
+			catch (...)
 			{
 				// ignore all errors.
 			}
+		}
 
-			free(json_body);
-			return;
+		// Loads httpfs if it is not loaded yet but already installed. Telemetry never installs it, as that would
+		// download the extension with no time limit. Returns false if it is unavailable.
+		bool loadHTTPFS(DatabaseInstance &db)
+		{
+			if (db.ExtensionIsLoaded("httpfs"))
+			{
+				return true;
+			}
+			try
+			{
+				ExtensionHelper::LoadExternalExtension(db, FileSystem::GetFileSystem(db), "httpfs");
+			}
+			catch (...)
+			{
+				return false;
+			}
+			return db.ExtensionIsLoaded("httpfs");
+		}
+
+#ifndef __EMSCRIPTEN__
+		// Sends still in flight; further loads skip telemetry rather than queue up behind a slow network
+		constexpr int MAX_PENDING_SENDS = 1;
+		std::atomic<int> pending_sends{0};
+
+		// Releases the body and the pending send on every path out of sendInBackground
+		struct PendingSend
+		{
+			char *json_body;
+
+			~PendingSend()
+			{
+				free(json_body);
+				pending_sends--;
+			}
+		};
+
+		// Runs on a detached thread, so neither loading httpfs nor the request delay LOAD. A database that is closed
+		// before the thread gets to run is not kept alive for it. Otherwise the thread holds the database only while it
+		// loads an installed httpfs from disk and sends the request, which gives up after TELEMETRY_TIMEOUT_SECONDS;
+		// closing the database in the meantime frees it once the thread lets go. Nothing may escape this function, as
+		// that would terminate the process.
+		void sendInBackground(weak_ptr<DatabaseInstance> weak_db, char *json_body, size_t json_body_size)
+		{
+			PendingSend pending{json_body};
+			try
+			{
+				auto db = weak_db.lock();
+				if (db && loadHTTPFS(*db))
+				{
+					sendHTTPRequest(*db, json_body, json_body_size);
+				}
+			}
+			catch (...)
+			{
+				// ignore all errors.
+			}
 		}
+#endif
 
 	} // namespace
 
@@ -52,20 +115,6 @@ namespace duckdb
 			return;
 		}
 
-		try
-		{
-			ExtensionHelper::TryAutoLoadExtension(loader.GetDatabaseInstance(), "httpfs");
-		}
-		catch (...)
-		{
-			return;
-		}
-
-		if (!loader.GetDatabaseInstance().ExtensionIsLoaded("httpfs"))
-		{
-			return;
-		}
-
 		// Initialize the telemetry sender
 		auto doc = yyjson_mut_doc_new(nullptr);
 
@@ -94,12 +143,29 @@ namespace duckdb
 		yyjson_mut_doc_free(doc);
 
 #ifndef __EMSCRIPTEN__
-		[[maybe_unused]] auto _ = std::async(
-				std::launch::async, [db_ptr = loader.GetDatabaseInstance().shared_from_this(), json = telemetry_data,
-														 len = telemetry_len]() mutable
-				{ sendHTTPRequest(std::move(db_ptr), json, len); });
+		if (pending_sends.fetch_add(1) >= MAX_PENDING_SENDS)
+		{
+			pending_sends--;
+			free(telemetry_data);
+			return;
+		}
+		try
+		{
+			weak_ptr<DatabaseInstance> weak_db = loader.GetDatabaseInstance().shared_from_this();
+			std::thread(sendInBackground, std::move(weak_db), telemetry_data, telemetry_len).detach();
+		}
+		catch (...)
+		{
+			// No thread could be started
+			pending_sends--;
+			free(telemetry_data);
+		}
 #else
-		sendHTTPRequest(loader.GetDatabaseInstance().shared_from_this(), telemetry_data, telemetry_len);
+		if (loadHTTPFS(loader.GetDatabaseInstance()))
+		{
+			sendHTTPRequest(loader.GetDatabaseInstance(), telemetry_data, telemetry_len);
+		}
+		free(telemetry_data);
 #endif
 	}
 